@@ -4,6 +4,18 @@
 #include "ACFActionTypes.h"
 #include "GameplayTagContainer.h"
 
+void UACFActionsSet::PostInitProperties()
+{
+    Super::PostInitProperties();
+    BuildActionIndices();
+}
+
+void UACFActionsSet::PostLoad()
+{
+    Super::PostLoad();
+    BuildActionIndices();
+}
+
 /**
  * Retrieves an action by tag from the actions set.
  * @param Action - The gameplay tag to search for.
@@ -12,7 +24,7 @@
  */
 bool UACFActionsSet::GetActionByTag(const FGameplayTag& Action, FActionState& outAction) const
 {
-    const FActionState* actionState = Actions.FindByKey(Action);
+    const FActionState* actionState = FindActionByTag(Action);
     if (actionState)
     {
         outAction = *actionState;
@@ -21,6 +33,31 @@ bool UACFActionsSet::GetActionByTag(const FGameplayTag& Action, FActionState& ou
     return false;
 }
 
+/**
+ * Retrieves an action by tag through the tag-to-index hash.
+ * Actions is editable from blueprints, so a stale index is detected and rebuilt.
+ * @param Action - The gameplay tag to search for.
+ * @return the found action state, nullptr otherwise.
+ */
+const FActionState* UACFActionsSet::FindActionByTag(const FGameplayTag& Action) const
+{
+    const int32* index = actionIndices.Find(Action);
+    if (index && Actions.IsValidIndex(*index) && Actions[*index].TagName == Action)
+    {
+        return &Actions[*index];
+    }
+
+    // A miss is only trusted if the index covers the whole array
+    if (!index && indexedActionsNum == Actions.Num())
+    {
+        return nullptr;
+    }
+
+    BuildActionIndices();
+    index = actionIndices.Find(Action);
+    return index ? &Actions[*index] : nullptr;
+}
+
 /**
  * Adds a new action or updates an existing one with the same tag.
  * Ensures there are no duplicate actions for a given tag.
@@ -33,4 +70,22 @@ void UACFActionsSet::AddOrModifyAction(const FActionState& action)
         Actions.Remove(action);
     }
     Actions.AddUnique(action);
-}
\ No newline at end of file
+    BuildActionIndices();
+}
+
+/**
+ * Maps every action tag to its index, the first action wins as with FindByKey.
+ */
+void UACFActionsSet::BuildActionIndices() const
+{
+    actionIndices.Reset();
+    actionIndices.Reserve(Actions.Num());
+    indexedActionsNum = Actions.Num();
+    for (int32 index = 0; index < Actions.Num(); index++)
+    {
+        if (!actionIndices.Contains(Actions[index].TagName))
+        {
+            actionIndices.Add(Actions[index].TagName, index);
+        }
+    }
+}
@@ -336,11 +336,9 @@ UACFBaseAction::UACFBaseAction()
 
 float UACFBaseAction::GetCooldownTimeRemaining()
 {
-    UWorld* world = GetWorld();
-    if (world)
+    if (ActionsManager)
     {
-        return world->GetTimerManager().GetTimerRemaining(CooldownTimerReference);
-
+        return ActionsManager->GetCooldownTimeRemaining(ActionTag);
     }
     return 0.0f;
 }
@@ -8,6 +8,7 @@
 #include "ARSTypes.h"
 #include "Actions/ACFBaseAction.h"
 #include "Actions/ACFSustainedAction.h"
+#include "Components/ACFCooldownSubsystem.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "MotionWarpingComponent.h"
 #include "Net/Core/PushModel/PushModel.h"
@@ -102,10 +103,10 @@ void UACFActionsManagerComponent::StopActionImmeditaley_Implementation()
 // Helper: Stops current animation montage (if any).
 void UACFActionsManagerComponent::Internal_StopCurrentAnimation()
 {
-    FActionState action;
-    if (GetActionByTag(CurrentActionTag, action))
+    const FActionState* action = FindActionByTag(CurrentActionTag);
+    if (action)
     {
-        animInst->Montage_Stop(0.0f, action.MontageAction);
+        animInst->Montage_Stop(0.0f, action->MontageAction);
     }
 }
 
@@ -119,6 +120,7 @@ void UACFActionsManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimePro
     DOREPLIFETIME(UACFActionsManagerComponent, CurrentPriority);
     DOREPLIFETIME(UACFActionsManagerComponent, bIsPerformingAction);
     DOREPLIFETIME(UACFActionsManagerComponent, currentMovesetActionsTag);
+    DOREPLIFETIME_CONDITION(UACFActionsManagerComponent, replicatedCooldowns, COND_OwnerOnly);
 }
 
 // On tick: if an action is ongoing, call its tick method to allow combo/charge logic.
@@ -189,12 +191,13 @@ void UACFActionsManagerComponent::TriggerAction_Implementation(FGameplayTag Acti
 
     OnActionTriggered.Broadcast(ActionState, Priority);
 
-    FActionState action;
-    if (GetActionByTag(ActionState, action) && action.Action && CanExecuteAction(ActionState, ItemSlotTag))
+    // resolved once and reused up to the launch
+    const FActionState* action = FindActionByTag(ActionState);
+    if (action && action->Action && Internal_CanExecuteAction(*action, ActionState, ItemSlotTag))
     {
         if (((static_cast<int32>(Priority) > CurrentPriority)) || Priority == EActionPriority::EHighest)
         {
-            LaunchAction(ActionState, Priority, contextString, InteractedActor, ItemSlotTag);
+            Internal_LaunchAction(*action, ActionState, Priority, contextString, InteractedActor, ItemSlotTag);
         } else if (CurrentActionTag != FGameplayTag() && bCanStoreAction && bCanBeStored)
         {
             StoreAction(ActionState, contextString);
@@ -228,7 +231,19 @@ void UACFActionsManagerComponent::ClientPlayMontage_Implementation(const FACFMon
 bool UACFActionsManagerComponent::IsActionOnCooldown(
     FGameplayTag action) const
 {
-    return onCooldownActions.Contains(action);
+    const double* expiryTime = cooldownExpiries.Find(action);
+    return expiryTime && *expiryTime > UACFCooldownSubsystem::GetCooldownTime(GetWorld());
+}
+
+// Returns the seconds left on the cooldown of the given action.
+float UACFActionsManagerComponent::GetCooldownTimeRemaining(FGameplayTag action) const
+{
+    const double* expiryTime = cooldownExpiries.Find(action);
+    if (!expiryTime)
+    {
+        return 0.f;
+    }
+    return FMath::Max(static_cast<float>(*expiryTime - UACFCooldownSubsystem::GetCooldownTime(GetWorld())), 0.f);
 }
 
 // Stores an action for later (action queueing).
@@ -242,21 +257,33 @@ void UACFActionsManagerComponent::StoreAction(FGameplayTag ActionState, const FS
 void UACFActionsManagerComponent::LaunchAction(const FGameplayTag& ActionState,
     const EActionPriority priority, const FString& contextString, AActor* InteractedActor, const FGameplayTag& ItemSlotTag)
 {
-    FActionState action;
+    const FActionState* action = FindActionByTag(ActionState);
+    if (action)
+    {
+        Internal_LaunchAction(*action, ActionState, priority, contextString, InteractedActor, ItemSlotTag);
+    }
+}
 
-    if (GetActionByTag(ActionState, action) && action.Action)
+void UACFActionsManagerComponent::Internal_LaunchAction(const FActionState& action, const FGameplayTag& ActionState,
+    const EActionPriority priority, const FString& contextString, AActor* InteractedActor, const FGameplayTag& ItemSlotTag)
+{
+    // the action callbacks below may modify the actions sets, keep what we need before running them
+    UACFBaseAction* newAction = action.Action;
+    UAnimMontage* montageAction = action.MontageAction;
+
+    if (newAction)
     {
         if (PerformingAction)
         {
-            action.Action->OnActionTransition(PerformingAction);
+            newAction->OnActionTransition(PerformingAction);
             TerminateCurrentAction();
         }
-        PerformingAction = action.Action;
+        PerformingAction = newAction;
         CurrentActionTag = ActionState;
         bIsPerformingAction = true;
         PerformingAction->SetTerminated(false);
         CurrentPriority = static_cast<int32>(priority);
-        PerformingAction->Internal_OnActivated(this, action.MontageAction, contextString, InteractedActor, ItemSlotTag);
+        PerformingAction->Internal_OnActivated(this, montageAction, contextString, InteractedActor, ItemSlotTag);
         ClientsReceiveActionStarted(ActionState, contextString);
 
         if (PerformingAction && PerformingAction->ActionConfig.bPlayEffectOnActionStart)
@@ -293,10 +320,10 @@ void UACFActionsManagerComponent::ClientsReceiveActionEnded_Implementation(
     const FGameplayTag& ActionState)
 {
     PrintStateDebugInfo(false);
-    FActionState action;
-    if (GetActionByTag(ActionState, action) && action.Action)
+    const FActionState* action = FindActionByTag(ActionState);
+    if (action && action->Action)
     {
-        action.Action->ClientsOnActionEnded();
+        action->Action->ClientsOnActionEnded();
     }
     OnActionFinished.Broadcast(ActionState);
 }
@@ -315,24 +342,34 @@ void UACFActionsManagerComponent::ClientsReceiveActionStarted_Implementation(
     OnActionStarted.Broadcast(ActionState);
     PrintStateDebugInfo(true);
 
-    FActionState action;
-    if (GetActionByTag(ActionState, action) && action.Action)
+    const FActionState* action = FindActionByTag(ActionState);
+    if (action && action->Action)
     {
-        PerformingAction = action.Action;
-        if (action.Action->GetActionConfig().bAutoStartCooldown)
+        PerformingAction = action->Action;
+        if (PerformingAction->GetActionConfig().bAutoStartCooldown)
         {
             StartCooldown(ActionState, PerformingAction);
         }
-        action.Action->CharacterOwner = CharacterOwner;
-        action.Action->ClientsOnActionStarted(contextString);
+        PerformingAction->CharacterOwner = CharacterOwner;
+        PerformingAction->ClientsOnActionStarted(contextString);
     }
 }
 
 // Returns whether the given action meets requirements, is not on cooldown, etc.
 bool UACFActionsManagerComponent::CanExecuteAction(FGameplayTag ActionState, FGameplayTag ItemSlotTag) const
 {
-    FActionState action;
-    if (GetActionByTag(ActionState, action) && action.Action && StatisticComp)
+    const FActionState* action = FindActionByTag(ActionState);
+    if (action)
+    {
+        return Internal_CanExecuteAction(*action, ActionState, ItemSlotTag);
+    }
+    UE_LOG(LogTemp, Warning, TEXT("Actions Conditions are not verified"));
+    return false;
+}
+
+bool UACFActionsManagerComponent::Internal_CanExecuteAction(const FActionState& action, const FGameplayTag& ActionState, const FGameplayTag& ItemSlotTag) const
+{
+    if (action.Action && StatisticComp)
     {
         UCharacterMovementComponent* moveComp = CharacterOwner->GetCharacterMovement();
         if (moveComp && !action.Action->ActionConfig.PerformableInMovementModes.Contains(moveComp->MovementMode))
@@ -425,13 +462,10 @@ void UACFActionsManagerComponent::FreeAction()
 // Gets a moveset-specific action by tag.
 bool UACFActionsManagerComponent::GetMovesetActionByTag(const FGameplayTag& action, const FGameplayTag& Moveset, FActionState& outAction) const
 {
-    if (MovesetsActionsInst.Contains(Moveset))
+    const TObjectPtr<UACFActionsSet>* actionSet = MovesetsActionsInst.Find(Moveset);
+    if (actionSet && *actionSet)
     {
-        UACFActionsSet* actionSet = MovesetsActionsInst.FindChecked(Moveset);
-        if (actionSet)
-        {
-            return actionSet->GetActionByTag(action, outAction);
-        }
+        return (*actionSet)->GetActionByTag(action, outAction);
     }
     return false;
 }
@@ -470,21 +504,32 @@ FGameplayTag UACFActionsManagerComponent::GetCurrentActionTag() const
 // Gets the action state by tag (searches moveset and common actions).
 bool UACFActionsManagerComponent::GetActionByTag(const FGameplayTag& Action, FActionState& outAction) const
 {
-    if (ActionsSetInst)
+    const FActionState* action = FindActionByTag(Action);
+    if (action)
     {
-        if (GetMovesetActionByTag(Action, currentMovesetActionsTag, outAction))
-        {
-            return true;
-        }
-        if (GetCommonActionByTag(Action, outAction))
+        outAction = *action;
+        return true;
+    }
+    return false;
+}
+
+// Finds the action state by tag without copying it (searches moveset and common actions).
+const FActionState* UACFActionsManagerComponent::FindActionByTag(const FGameplayTag& Action) const
+{
+    if (!ActionsSetInst)
+    {
+        return nullptr;
+    }
+
+    const TObjectPtr<UACFActionsSet>* moveset = MovesetsActionsInst.Find(currentMovesetActionsTag);
+    if (moveset && *moveset)
+    {
+        if (const FActionState* action = (*moveset)->FindActionByTag(Action))
         {
-            return true;
+            return action;
         }
-    } else
-    {
-        return false;
     }
-    return false;
+    return ActionsSetInst->FindActionByTag(Action);
 }
 
 // Plays the effects for the current action (VFX/SFX).
@@ -634,24 +679,71 @@ void UACFActionsManagerComponent::PrepareWarp()
 // Starts a cooldown for the given action, preventing immediate retriggering.
 void UACFActionsManagerComponent::StartCooldown(const FGameplayTag& action, UACFBaseAction* actionRef)
 {
-    if (actionRef->GetActionConfig().CoolDownTime == 0.f)
+    const float coolDownTime = actionRef->GetActionConfig().CoolDownTime;
+    UWorld* world = GetWorld();
+    if (coolDownTime == 0.f || !world)
     {
         return;
     }
 
-    FTimerDelegate TimerDel;
-    FTimerHandle TimerHandle;
-    TimerDel.BindUFunction(this, FName("OnCooldownFinished"), action);
+    const double now = UACFCooldownSubsystem::GetCooldownTime(world);
+    const double expiryTime = now + coolDownTime;
+    cooldownExpiries.Add(action, expiryTime);
+
+    if (GetOwnerRole() == ROLE_Authority)
+    {
+        // only running cooldowns are replicated
+        replicatedCooldowns.RemoveAllSwap([&](const FACFActionCooldown& cooldown) {
+            return cooldown.Action == action || cooldown.ExpiryTime <= now;
+        });
+        FACFActionCooldown& cooldown = replicatedCooldowns.AddDefaulted_GetRef();
+        cooldown.Action = action;
+        cooldown.ExpiryTime = expiryTime;
+    }
+
+    ScheduleCooldownExpiry(action, expiryTime);
+}
+
+// Applies the server cooldown timestamps.
+void UACFActionsManagerComponent::OnRep_Cooldowns()
+{
+    for (const FACFActionCooldown& cooldown : replicatedCooldowns)
+    {
+        const double* localExpiry = cooldownExpiries.Find(cooldown.Action);
+        if (!localExpiry || !FMath::IsNearlyEqual(*localExpiry, static_cast<double>(cooldown.ExpiryTime), 0.05))
+        {
+            cooldownExpiries.Add(cooldown.Action, cooldown.ExpiryTime);
+            ScheduleCooldownExpiry(cooldown.Action, cooldown.ExpiryTime);
+        }
+    }
+}
+
+void UACFActionsManagerComponent::ScheduleCooldownExpiry(const FGameplayTag& action, double expiryTime)
+{
+    if (!OnCooldownEnded.IsBound())
+    {
+        return;
+    }
 
     UWorld* world = GetWorld();
-    if (world)
+    UACFCooldownSubsystem* cooldownSubsystem = world ? world->GetSubsystem<UACFCooldownSubsystem>() : nullptr;
+    if (cooldownSubsystem)
     {
-        onCooldownActions.Add(action);
-        world->GetTimerManager().SetTimer(
-            TimerHandle, TimerDel, actionRef->GetActionConfig().CoolDownTime,
-            false);
-        actionRef->CooldownTimerReference = TimerHandle;
+        cooldownSubsystem->ScheduleExpiry(this, action, expiryTime);
+    }
+}
+
+// Broadcasts the end of a cooldown, unless it has been restarted meanwhile.
+void UACFActionsManagerComponent::HandleCooldownExpired(const FGameplayTag& action, double expiryTime)
+{
+    const double* currentExpiry = cooldownExpiries.Find(action);
+    if (!currentExpiry || *currentExpiry > expiryTime)
+    {
+        return;
     }
+
+    cooldownExpiries.Remove(action);
+    OnCooldownEnded.Broadcast(action);
 }
 
 // Handler for montage info replication.
@@ -660,12 +752,3 @@ void UACFActionsManagerComponent::OnRep_MontageInfo()
     // PlayCurrentMontage();
 }
 
-// Removes the action from cooldowns when timer elapses.
-void UACFActionsManagerComponent::OnCooldownFinished(
-    const FGameplayTag& action)
-{
-    if (onCooldownActions.Contains(action))
-    {
-        onCooldownActions.Remove(action);
-    }
-}
\ No newline at end of file
@@ -0,0 +1,91 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "Components/ACFCooldownSubsystem.h"
+#include "Components/ACFActionsManagerComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "TimerManager.h"
+
+double UACFCooldownSubsystem::GetCooldownTime(const UWorld* world)
+{
+    if (!world)
+    {
+        return 0.0;
+    }
+    const AGameStateBase* gameState = world->GetGameState();
+    return gameState ? gameState->GetServerWorldTimeSeconds() : world->GetTimeSeconds();
+}
+
+void UACFCooldownSubsystem::ScheduleExpiry(UACFActionsManagerComponent* manager, const FGameplayTag& action, double expiryTime)
+{
+    if (!manager)
+    {
+        return;
+    }
+
+    FACFCooldownExpiry expiry;
+    expiry.ExpiryTime = expiryTime;
+    expiry.Manager = manager;
+    expiry.Action = action;
+
+    const bool bNewEarliest = expiries.Num() == 0 || expiryTime < expiries.HeapTop().ExpiryTime;
+    expiries.HeapPush(expiry);
+    if (bNewEarliest)
+    {
+        ScheduleNextExpiry();
+    }
+}
+
+void UACFCooldownSubsystem::Deinitialize()
+{
+    if (UWorld* world = GetWorld())
+    {
+        world->GetTimerManager().ClearTimer(expiryTimerHandle);
+    }
+    expiries.Empty();
+
+    Super::Deinitialize();
+}
+
+void UACFCooldownSubsystem::ScheduleNextExpiry()
+{
+    UWorld* world = GetWorld();
+    if (!world)
+    {
+        return;
+    }
+
+    if (expiries.Num() == 0)
+    {
+        world->GetTimerManager().ClearTimer(expiryTimerHandle);
+        return;
+    }
+
+    // Timers need a positive delay, expiries already due are delivered on the next tick
+    const float delay = FMath::Max(static_cast<float>(expiries.HeapTop().ExpiryTime - GetCooldownTime(world)), KINDA_SMALL_NUMBER);
+    world->GetTimerManager().SetTimer(expiryTimerHandle, this, &UACFCooldownSubsystem::HandleExpiryTimer, delay, false);
+}
+
+void UACFCooldownSubsystem::HandleExpiryTimer()
+{
+    const double now = GetCooldownTime(GetWorld());
+
+    // Notifications can schedule new expiries, pop the due ones first
+    TArray<FACFCooldownExpiry> dueExpiries;
+    while (expiries.Num() > 0 && expiries.HeapTop().ExpiryTime <= now)
+    {
+        FACFCooldownExpiry expiry;
+        expiries.HeapPop(expiry);
+        dueExpiries.Add(expiry);
+    }
+
+    for (const FACFCooldownExpiry& expiry : dueExpiries)
+    {
+        if (UACFActionsManagerComponent* manager = expiry.Manager.Get())
+        {
+            manager->HandleCooldownExpired(expiry.Action, expiry.ExpiryTime);
+        }
+    }
+
+    ScheduleNextExpiry();
+}
@@ -185,6 +185,20 @@ public:
     TObjectPtr<class UACFBaseAction> Action;
 };
 
+/*Cooldown of an action, replicated as the timestamp at which it expires*/
+USTRUCT()
+struct FACFActionCooldown {
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    FGameplayTag Action;
+
+    /*See UACFCooldownSubsystem::GetCooldownTime*/
+    UPROPERTY()
+    float ExpiryTime = 0.f;
+};
+
 USTRUCT(BlueprintType)
 struct FActionsSet : public FACFStruct {
 
@@ -17,6 +17,7 @@
  * - Assign this to a character, weapon, or moveset to define its available actions.
  * - Use AddOrModifyAction to dynamically update actions at runtime (e.g., buffs, unlocks).
  * - Use GetActionByTag to retrieve an action definition by its gameplay tag.
+ * - Use FindActionByTag from C++ to read an action without copying it, through a tag-to-index hash.
  * - Use GetActions to retrieve the full list of defined actions.
  *
  * Blueprintable and Editor-friendly: Actions can be edited in data assets.
@@ -46,6 +47,14 @@ public:
      */
     bool GetActionByTag(const FGameplayTag& action, FActionState& outAction) const;
 
+    /**
+     * Looks for an action by its tag without copying it.
+     * The returned pointer is invalidated as soon as the set is modified.
+     * @param action - The gameplay tag to search for.
+     * @return the action state, nullptr if not found.
+     */
+    const FActionState* FindActionByTag(const FGameplayTag& action) const;
+
     /**
      * Retrieves all actions in this set.
      * @param outActions - Array populated with all actions.
@@ -54,4 +63,18 @@ public:
     {
         outActions = Actions;
     }
+
+    virtual void PostInitProperties() override;
+
+    virtual void PostLoad() override;
+
+private:
+    /** Index of each action in Actions, keyed by tag */
+    mutable TMap<FGameplayTag, int32> actionIndices;
+
+    /** Size of Actions when actionIndices was built */
+    mutable int32 indexedActionsNum = INDEX_NONE;
+
+    /** Rebuilds actionIndices, called on load and whenever Actions is found out of sync */
+    void BuildActionIndices() const;
 };
\ No newline at end of file
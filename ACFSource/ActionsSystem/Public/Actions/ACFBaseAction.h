@@ -275,8 +275,8 @@ protected:
     /** Statistics component of the owning character (auto-set). */
     TObjectPtr<class UARSStatisticsComponent> StatisticComp;
 
-    /** Reference to the cooldown timer for this action (for UI and logic). */
-    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    /** No longer set: cooldowns are timestamps stored by the actions manager, use GetCooldownTimeRemaining. */
+    UPROPERTY(BlueprintReadOnly, Category = ACF, meta = (DeprecatedProperty, DeprecationMessage = "Cooldowns no longer use timers, use GetCooldownTimeRemaining"))
     FTimerHandle CooldownTimerReference;
 
     //
@@ -25,6 +25,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnActionEnded, FGameplayTag, Action
 // Delegate for broadcasting when an action is triggered (passes the tag and priority)
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnActionTriggered, FGameplayTag, ActionState, EActionPriority, Priority);
 
+// Delegate for broadcasting when the cooldown of an action ends (passes the tag of the action)
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnActionCooldownEnded, FGameplayTag, ActionState);
+
 /**
  * UACFActionsManagerComponent
  *
@@ -178,6 +181,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = ACF)
     bool IsActionOnCooldown(FGameplayTag action) const;
 
+    /** Returns the seconds left on the cooldown of the given action, 0 if it is ready. */
+    UFUNCTION(BlueprintPure, Category = ACF)
+    float GetCooldownTimeRemaining(FGameplayTag action) const;
+
+    /** Called by UACFCooldownSubsystem when a scheduled cooldown expires, broadcasts OnCooldownEnded if it is still current. */
+    void HandleCooldownExpired(const FGameplayTag& action, double expiryTime);
+
     /** Stores an action for later execution (usually after the current action ends). */
     UFUNCTION(BlueprintCallable, Category = ACF)
     void StoreAction(FGameplayTag Action, const FString& contextString = "");
@@ -217,6 +227,10 @@ public:
     UPROPERTY(BlueprintAssignable, Category = ACF)
     FOnActionTriggered OnActionTriggered;
 
+    /** Event called when the cooldown of an action ends (BlueprintAssignable). Expiries are only scheduled while this is bound. */
+    UPROPERTY(BlueprintAssignable, Category = ACF)
+    FOnActionCooldownEnded OnCooldownEnded;
+
     /** Gets the currently executing action's tag, or empty if none. */
     UFUNCTION(BlueprintPure, Category = ACF)
     FGameplayTag GetCurrentActionTag() const;
@@ -236,6 +250,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = ACF)
     bool GetActionByTag(const FGameplayTag& Action, FActionState& outAction) const;
 
+    /** Gets the action state by tag without copying it (moveset first, then common actions). Invalidated when the sets change. */
+    const FActionState* FindActionByTag(const FGameplayTag& Action) const;
+
     /** Plays any VFX/SFX associated with the current action. */
     UFUNCTION(BlueprintCallable, Category = ACF)
     void PlayCurrentActionFX();
@@ -296,6 +313,12 @@ private:
     /** Core logic for launching an action (transitions, VFX, montage, etc.). */
     void LaunchAction(const FGameplayTag& ActionState, const EActionPriority priority, const FString& contextString = "", AActor* InteractedActor = nullptr, const FGameplayTag& ItemSlotTag = FGameplayTag());
 
+    /** LaunchAction with the action already resolved by TriggerAction. */
+    void Internal_LaunchAction(const FActionState& action, const FGameplayTag& ActionState, const EActionPriority priority, const FString& contextString, AActor* InteractedActor, const FGameplayTag& ItemSlotTag);
+
+    /** CanExecuteAction with the action already resolved. */
+    bool Internal_CanExecuteAction(const FActionState& action, const FGameplayTag& ActionState, const FGameplayTag& ItemSlotTag) const;
+
     /** Sets the current action tag (internal). */
     void SetCurrentAction(const FGameplayTag& state);
 
@@ -365,9 +388,19 @@ private:
     /** Prepares root motion warping for current action's montage (if any). */
     void PrepareWarp();
 
-    /** List of actions currently on cooldown (prevents immediate retrigger). */
-    UPROPERTY()
-    TArray<FGameplayTag> onCooldownActions;
+    /** Expiry timestamp of each action cooldown (see UACFCooldownSubsystem::GetCooldownTime), ready checks need no timers. */
+    TMap<FGameplayTag, double> cooldownExpiries;
+
+    /** Running cooldowns replicated to the owner as compact timestamps. */
+    UPROPERTY(ReplicatedUsing = OnRep_Cooldowns)
+    TArray<FACFActionCooldown> replicatedCooldowns;
+
+    /** Handler for cooldowns replication notification. */
+    UFUNCTION()
+    void OnRep_Cooldowns();
+
+    /** Schedules the OnCooldownEnded notification if someone listens to it. */
+    void ScheduleCooldownExpiry(const FGameplayTag& action, double expiryTime);
 
     /** Replicated montage info for synchronizing animation playback. */
     UPROPERTY(ReplicatedUsing = OnRep_MontageInfo)
@@ -377,10 +410,6 @@ private:
     UFUNCTION()
     void OnRep_MontageInfo();
 
-    /** Handler called when a cooldown finishes for an action. */
-    UFUNCTION()
-    void OnCooldownFinished(const FGameplayTag& action);
-
     /** Helper to stop the current animation immediately. */
     void Internal_StopCurrentAnimation();
 
@@ -0,0 +1,56 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ACFCooldownSubsystem.generated.h"
+
+class UACFActionsManagerComponent;
+
+/**
+ * UACFCooldownSubsystem
+ *
+ * Single ticker for the action cooldowns of a world.
+ * Cooldowns are plain expiry timestamps stored by each UACFActionsManagerComponent, so checking them needs no timers.
+ * This subsystem only keeps the expiries of the components that listen to OnCooldownEnded in a min-heap,
+ * with one timer armed on the earliest one.
+ */
+UCLASS()
+class ACTIONSSYSTEM_API UACFCooldownSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Time base of the cooldown timestamps: the server world time, so they can be replicated as is. */
+    static double GetCooldownTime(const UWorld* world);
+
+    /** Schedules the expiry notification of the action cooldown of the provided component. */
+    void ScheduleExpiry(UACFActionsManagerComponent* manager, const FGameplayTag& action, double expiryTime);
+
+    virtual void Deinitialize() override;
+
+private:
+    struct FACFCooldownExpiry
+    {
+        double ExpiryTime = 0.0;
+        TWeakObjectPtr<UACFActionsManagerComponent> Manager;
+        FGameplayTag Action;
+
+        bool operator<(const FACFCooldownExpiry& other) const
+        {
+            return ExpiryTime < other.ExpiryTime;
+        }
+    };
+
+    /** Pending expiries, the earliest on top */
+    TArray<FACFCooldownExpiry> expiries;
+
+    FTimerHandle expiryTimerHandle;
+
+    void ScheduleNextExpiry();
+
+    void HandleExpiryTimer();
+};
@@ -7,6 +7,8 @@
 #include "Components/ACFTeamManagerComponent.h"
 #include "Engine/DamageEvents.h"
 #include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "TimerManager.h"
 #include "Game/ACFDamageType.h"
 #include "Game/ACFDamageTypeCalculator.h"
 #include "Game/ACFFunctionLibrary.h"
@@ -74,11 +76,23 @@ void UACFDamageHandlerComponent::AssignCollisionProfile(const TEnumAsByte<EColli
 void UACFDamageHandlerComponent::BeginPlay()
 {
     Super::BeginPlay();
+    // Cache the components used on every hit
+    statisticsComp = GetOwner()->FindComponentByClass<UARSStatisticsComponent>();
+    InitializeDamageCalculator();
+
     // Bind to the OnStatisiticReachesZero delegate for health/stat depletion events
-    UARSStatisticsComponent* StatisticsComp = GetOwner()->FindComponentByClass<UARSStatisticsComponent>();
-    if (StatisticsComp && !StatisticsComp->OnStatisiticReachesZero.IsAlreadyBound(this, &UACFDamageHandlerComponent::HandleStatReachedZero))
+    if (statisticsComp && !statisticsComp->OnStatisiticReachesZero.IsAlreadyBound(this, &UACFDamageHandlerComponent::HandleStatReachedZero))
+    {
+        statisticsComp->OnStatisiticReachesZero.AddDynamic(this, &UACFDamageHandlerComponent::HandleStatReachedZero);
+    }
+}
+
+void UACFDamageHandlerComponent::InitializeDamageCalculator()
+{
+    if (DamageCalculatorClass && !DamageCalculator)
     {
-        StatisticsComp->OnStatisiticReachesZero.AddDynamic(this, &UACFDamageHandlerComponent::HandleStatReachedZero);
+        DamageCalculator = NewObject<UACFDamageCalculation>(this, DamageCalculatorClass);
+        DamageCalculator->InitializeDamageContext(GetOwner());
     }
 }
 
@@ -101,15 +115,16 @@ float UACFDamageHandlerComponent::TakeDamage(class AActor* damageReceiver, float
         DamageCauser);
 
     // Get stats component and apply the final calculated damage as a stat modification
-    UARSStatisticsComponent* StatisticsComp = damageReceiver->FindComponentByClass<UARSStatisticsComponent>();
+    UARSStatisticsComponent* StatisticsComp = damageReceiver == GetOwner() ? statisticsComp : damageReceiver->FindComponentByClass<UARSStatisticsComponent>();
 
     if (StatisticsComp)
     {
         FStatisticValue statMod(UACFFunctionLibrary::GetHealthTag(), -LastDamageReceived.FinalDamage);
         StatisticsComp->ModifyStat(statMod);
     }
-    // Notify clients about the received damage for replication and event triggers
-    ClientsReceiveDamage(LastDamageReceived);
+    // Notify server listeners right away, clients receive the hits of this frame in a single compact batch
+    OnDamageReceived.Broadcast(LastDamageReceived);
+    QueueClientsDamage();
     return LastDamageReceived.FinalDamage;
 }
 
@@ -118,10 +133,9 @@ void UACFDamageHandlerComponent::Revive_Implementation()
     bIsAlive = true;
 
     // Restart stat regeneration on revive
-    UARSStatisticsComponent* StatisticsComp = GetOwner()->FindComponentByClass<UARSStatisticsComponent>();
-    if (StatisticsComp)
+    if (statisticsComp)
     {
-        StatisticsComp->StartRegeneration();
+        statisticsComp->StartRegeneration();
     }
 }
 
@@ -196,12 +210,9 @@ void UACFDamageHandlerComponent::ConstructDamageReceived(AActor* DamagedActor, f
     }
 
     // Use the damage calculator to evaluate hit response, critical state, and recalculate final damage
-    if (DamageCalculatorClass)
+    InitializeDamageCalculator();
+    if (DamageCalculator)
     {
-        if (!DamageCalculator)
-        {
-            DamageCalculator = NewObject<UACFDamageCalculation>(this, DamageCalculatorClass);
-        }
         TempDamageEvent.HitResponseAction = DamageCalculator->EvaluateHitResponseAction(TempDamageEvent, HitResponseActions);
         TempDamageEvent.bIsCritical = DamageCalculator->IsCriticalDamage(TempDamageEvent);
         TempDamageEvent.FinalDamage = DamageCalculator->CalculateFinalDamage(TempDamageEvent);
@@ -223,16 +234,15 @@ void UACFDamageHandlerComponent::HandleStatReachedZero(FGameplayTag stat)
         if (GetOwner()->HasAuthority())
         {
             // Stop regeneration and award EXP to killer if applicable
-            UARSStatisticsComponent* StatisticsComp = GetOwner()->FindComponentByClass<UARSStatisticsComponent>();
-            if (StatisticsComp)
+            if (statisticsComp)
             {
-                StatisticsComp->StopRegeneration();
+                statisticsComp->StopRegeneration();
                 if (LastDamageReceived.DamageDealer)
                 {
                     UARSStatisticsComponent* dealerStatComp = LastDamageReceived.DamageDealer->FindComponentByClass<UARSStatisticsComponent>();
                     if (dealerStatComp)
                     {
-                        dealerStatComp->AddExp(StatisticsComp->GetExpOnDeath());
+                        dealerStatComp->AddExp(statisticsComp->GetExpOnDeath());
                     }
                 }
             }
@@ -243,9 +253,91 @@ void UACFDamageHandlerComponent::HandleStatReachedZero(FGameplayTag stat)
     }
 }
 
-void UACFDamageHandlerComponent::ClientsReceiveDamage_Implementation(const FACFDamageEvent& damageEvent)
+void UACFDamageHandlerComponent::QueueClientsDamage()
+{
+    FACFCompactDamageEvent& compactEvent = pendingClientsDamage.AddDefaulted_GetRef();
+    compactEvent.ImpactPoint = LastDamageReceived.HitResult.ImpactPoint;
+    compactEvent.HitDirection = LastDamageReceived.HitDirection.GetSafeNormal();
+    compactEvent.DamageClass = LastDamageReceived.DamageClass;
+    compactEvent.DamageDealer = LastDamageReceived.DamageDealer;
+    compactEvent.HitResponseAction = LastDamageReceived.HitResponseAction;
+    compactEvent.FinalDamage = LastDamageReceived.FinalDamage;
+    compactEvent.DamageZone = LastDamageReceived.DamageZone;
+    compactEvent.DamageDirection = LastDamageReceived.DamageDirection;
+    compactEvent.bIsCritical = LastDamageReceived.bIsCritical;
+
+    const ACharacter* characterOwner = Cast<ACharacter>(GetOwner());
+    if (characterOwner && characterOwner->GetMesh() && LastDamageReceived.HitResult.BoneName != NAME_None)
+    {
+        compactEvent.BoneIndex = characterOwner->GetMesh()->GetBoneIndex(LastDamageReceived.HitResult.BoneName);
+    }
+
+    // first hit of the frame, send the batch at the next tick
+    if (pendingClientsDamage.Num() == 1)
+    {
+        GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UACFDamageHandlerComponent::FlushClientsDamage);
+    }
+}
+
+void UACFDamageHandlerComponent::FlushClientsDamage()
+{
+    if (pendingClientsDamage.Num() > 0)
+    {
+        ClientsReceiveDamageBatch(pendingClientsDamage);
+        pendingClientsDamage.Reset();
+    }
+}
+
+FACFDamageEvent UACFDamageHandlerComponent::ExpandDamageEvent(const FACFCompactDamageEvent& compactEvent) const
+{
+    FACFDamageEvent damageEvent;
+    damageEvent.ContextString = NAME_None;
+    damageEvent.DamageReceiver = GetOwner();
+    damageEvent.DamageDealer = compactEvent.DamageDealer;
+    damageEvent.DamageClass = compactEvent.DamageClass;
+    damageEvent.HitResponseAction = compactEvent.HitResponseAction;
+    damageEvent.FinalDamage = compactEvent.FinalDamage;
+    damageEvent.HitDirection = compactEvent.HitDirection;
+    damageEvent.DamageZone = compactEvent.DamageZone;
+    damageEvent.DamageDirection = compactEvent.DamageDirection;
+    damageEvent.bIsCritical = compactEvent.bIsCritical;
+    damageEvent.HitResult.ImpactPoint = compactEvent.ImpactPoint;
+    damageEvent.HitResult.Location = compactEvent.ImpactPoint;
+    damageEvent.HitResult.HitObjectHandle = FActorInstanceHandle(GetOwner());
+
+    if (compactEvent.DamageClass)
+    {
+        const UACFDamageType* damageTypeCDO = compactEvent.DamageClass->GetDefaultObject<UACFDamageType>();
+        if (damageTypeCDO)
+        {
+            damageEvent.DamageTags.AppendTags(damageTypeCDO->DamageTags);
+        }
+    }
+
+    const ACharacter* characterOwner = Cast<ACharacter>(GetOwner());
+    if (characterOwner && characterOwner->GetMesh() && compactEvent.BoneIndex != INDEX_NONE)
+    {
+        damageEvent.HitResult.BoneName = characterOwner->GetMesh()->GetBoneName(compactEvent.BoneIndex);
+        FBodyInstance* bodyInstance = characterOwner->GetMesh()->GetBodyInstance(damageEvent.HitResult.BoneName);
+        if (bodyInstance)
+        {
+            damageEvent.PhysMaterial = bodyInstance->GetSimplePhysicalMaterial();
+        }
+    }
+    return damageEvent;
+}
+
+void UACFDamageHandlerComponent::ClientsReceiveDamageBatch_Implementation(const TArray<FACFCompactDamageEvent>& damageEvents)
 {
-    // Replicate the damage event to clients and broadcast the OnDamageReceived event
-    LastDamageReceived = damageEvent;
-    OnDamageReceived.Broadcast(damageEvent);
-}
\ No newline at end of file
+    // the server already broadcast the full events
+    if (GetOwner()->HasAuthority())
+    {
+        return;
+    }
+
+    for (const FACFCompactDamageEvent& compactEvent : damageEvents)
+    {
+        LastDamageReceived = ExpandDamageEvent(compactEvent);
+        OnDamageReceived.Broadcast(LastDamageReceived);
+    }
+}
@@ -8,13 +8,12 @@
 // Sets default values for this component's properties
 UACFInteractionComponent::UACFInteractionComponent()
 {
-    // Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-    // off to improve performance if you don't need them.
+    // Candidates are tracked from overlap events, the tick only runs while there are candidates to rescore
     PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
     SetCollisionResponseToAllChannels(ECR_Ignore);
     SetCollisionEnabled(ECollisionEnabled::NoCollision);
     CollisionChannels.Add(ECC_Pawn);
-    SetComponentTickEnabled(true);
     SetIsReplicatedByDefault(true);
 }
 
@@ -115,63 +114,105 @@ void UACFInteractionComponent::OnActorEnteredDetector(UPrimitiveComponent* _over
     const bool bImplements = _otherActor->GetClass()->ImplementsInterface(UACFInteractableInterface::StaticClass());
     if (bImplements && PawnOwner && _otherActor != PawnOwner)
     {
-        interactables.AddUnique(_otherActor);
+        const bool bAlreadyTracked = candidates.ContainsByPredicate([_otherActor](const FACFInteractionCandidate& candidate) {
+            return candidate.Actor == _otherActor;
+        });
+        if (!bAlreadyTracked)
+        {
+            FACFInteractionCandidate& candidate = candidates.AddDefaulted_GetRef();
+            candidate.Actor = _otherActor;
+        }
         RefreshInteractions();
     }
 }
 
 void UACFInteractionComponent::OnActorLeavedDetector(UPrimitiveComponent* _overlappedComponent, AActor* _otherActor, UPrimitiveComponent* _otherComp, int32 _otherBodyIndex)
 {
-    if (interactables.Contains(_otherActor))
+    // removing keeps the order, no need to rescore
+    const int32 removed = candidates.RemoveAll([_otherActor](const FACFInteractionCandidate& candidate) {
+        return candidate.Actor == _otherActor;
+    });
+    if (removed > 0)
     {
-        interactables.Remove(_otherActor);
+        SelectBestCandidate();
+        UpdateTickState();
     }
-    RefreshInteractions();
-    //     if (currentBestInteractableActor && currentBestInteractableActor == _otherActor) {
-    //         SetCurrentBestInteractable(nullptr);
-    //     }
 }
 
 void UACFInteractionComponent::RefreshInteractions()
 {
-    bool bFound = false;
-    if (interactables.IsEmpty())
+    ScoreCandidates();
+    SelectBestCandidate();
+    UpdateTickState();
+}
+
+void UACFInteractionComponent::ScoreCandidates()
+{
+    candidates.RemoveAll([](const FACFInteractionCandidate& candidate) {
+        return !candidate.Actor.IsValid() || candidate.Actor->IsPendingKillPending();
+    });
+
+    if (!PawnOwner)
     {
-        SetCurrentBestInteractable(nullptr);
         return;
     }
-    // first we see if we can still interact with the current interactable
-    if (currentBestInteractableActor && !currentBestInteractableActor->IsPendingKillPending() &&
-        IACFInteractableInterface::Execute_CanBeInteracted(currentBestInteractableActor, PawnOwner))
+
+    PawnOwner->GetActorEyesViewPoint(lastScoredViewLocation, lastScoredViewRotation);
+    const FVector viewDirection = lastScoredViewRotation.Vector();
+    for (FACFInteractionCandidate& candidate : candidates)
     {
-        bFound = true;
-    } else
+        candidate.Score = ComputeScore(candidate.Actor.Get(), lastScoredViewLocation, viewDirection);
+    }
+
+    candidates.Sort([](const FACFInteractionCandidate& first, const FACFInteractionCandidate& second) {
+        return first.Score > second.Score;
+    });
+}
+
+float UACFInteractionComponent::ComputeScore(const AActor* actor, const FVector& viewLocation, const FVector& viewDirection) const
+{
+    // the actor origin can be far from the part the pawn faces (e.g. one actor for many instances)
+    const FVector interactionLocation = IACFInteractableInterface::Execute_GetInteractionLocation(actor, viewLocation);
+
+    // 1 next to the pawn, 0 at the border of the detector
+    const float distance = FVector::Dist(PawnOwner->GetActorLocation(), interactionLocation);
+    const float distanceScore = 1.f - FMath::Clamp(distance / FMath::Max(InteractableArea, 1.f), 0.f, 1.f);
+
+    // 1 in the center of the view, 0 behind it
+    const FVector toActor = (interactionLocation - viewLocation).GetSafeNormal();
+    const float viewAngleScore = (FVector::DotProduct(viewDirection, toActor) + 1.f) * 0.5f;
+
+    const float priority = IACFInteractableInterface::Execute_GetInteractionPriority(actor, PawnOwner);
+
+    return DistanceWeight * distanceScore + ViewAngleWeight * viewAngleScore + PriorityWeight * priority;
+}
+
+void UACFInteractionComponent::SelectBestCandidate()
+{
+    timeSinceRevalidation = 0.f;
+
+    AActor* bestCandidate = nullptr;
+    for (const FACFInteractionCandidate& candidate : candidates)
     {
-        //otherwise we try with the other interactables in the array
-        for (const auto& interactable : interactables)
+        AActor* candidateActor = candidate.Actor.Get();
+        if (candidateActor && !candidateActor->IsPendingKillPending() && IACFInteractableInterface::Execute_CanBeInteracted(candidateActor, PawnOwner))
         {
-
-            if (interactable && IACFInteractableInterface::Execute_CanBeInteracted(interactable, PawnOwner) && PawnOwner->GetDistanceTo(interactable) < PawnOwner->GetDistanceTo(currentBestInteractableActor))
-            {
-                SetCurrentBestInteractable(interactable);
-                bFound = true;
-                break;
-            }
-            if (IACFInteractableInterface::Execute_CanBeInteracted(interactable, PawnOwner))
-            {
-                SetCurrentBestInteractable(interactable);
-                bFound = true;
-                break;
-            }
+            bestCandidate = candidateActor;
+            break;
         }
     }
-    //if no one is interactable, just set it to nullpts
-    if (!bFound)
+
+    if (bestCandidate != currentBestInteractableActor)
     {
-        SetCurrentBestInteractable(nullptr);
+        SetCurrentBestInteractable(bestCandidate);
     }
 }
 
+void UACFInteractionComponent::UpdateTickState()
+{
+    SetComponentTickEnabled(candidates.Num() > 0 && PawnOwner && PawnOwner->IsLocallyControlled());
+}
+
 void UACFInteractionComponent::NomadRefreshInteractions(AActor* InInteractableActor)
 {
     bool bFound = false;
@@ -222,7 +263,29 @@ void UACFInteractionComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-    RefreshInteractions();
+    if (!PawnOwner)
+    {
+        return;
+    }
+
+    FVector viewLocation;
+    FRotator viewRotation;
+    PawnOwner->GetActorEyesViewPoint(viewLocation, viewRotation);
+
+    const bool bViewMoved = FVector::DistSquared(viewLocation, lastScoredViewLocation) > FMath::Square(RescoreDistanceThreshold) ||
+        !viewRotation.Equals(lastScoredViewRotation, RescoreAngleThreshold);
+
+    timeSinceRevalidation += DeltaTime;
+    if (bViewMoved)
+    {
+        ScoreCandidates();
+        SelectBestCandidate();
+        UpdateTickState();
+    } else if (timeSinceRevalidation >= RevalidationInterval)
+    {
+        // candidates can become (un)interactable while the view is still
+        SelectBestCandidate();
+    }
 }
 
 void UACFInteractionComponent::AddCollisionChannel(TEnumAsByte<ECollisionChannel> inTraceChannel)
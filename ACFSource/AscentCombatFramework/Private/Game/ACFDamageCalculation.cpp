@@ -1,6 +1,9 @@
 // Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved. 
 
 #include "Game/ACFDamageCalculation.h"
+#include "ARSStatisticsComponent.h"
+#include "Actors/ACFCharacter.h"
+#include "Components/ACFDefenseStanceComponent.h"
 #include "Game/ACFDamageType.h"
 
 /**
@@ -52,4 +55,44 @@ UACFDamageType* UACFDamageCalculation::GetDamageType(const FACFDamageEvent& inDa
     }
 
     return nullptr;
-}
\ No newline at end of file
+}
+
+void UACFDamageCalculation::InitializeDamageContext(AActor* damageReceiver)
+{
+    contextReceiver = damageReceiver;
+    receiverStatistics = damageReceiver ? damageReceiver->FindComponentByClass<UARSStatisticsComponent>() : nullptr;
+    receiverDefenseStance = damageReceiver ? damageReceiver->FindComponentByClass<UACFDefenseStanceComponent>() : nullptr;
+}
+
+UARSStatisticsComponent* UACFDamageCalculation::GetStatisticsComponent(const AActor* actor) const
+{
+    if (!actor)
+    {
+        return nullptr;
+    }
+    if (actor == contextReceiver.Get())
+    {
+        return receiverStatistics.Get();
+    }
+
+    // Damage dealers are mostly characters, which already hold a reference to it
+    const AACFCharacter* acfCharacter = Cast<AACFCharacter>(actor);
+    if (acfCharacter)
+    {
+        return acfCharacter->GetStatisticsComponent();
+    }
+    return actor->FindComponentByClass<UARSStatisticsComponent>();
+}
+
+UACFDefenseStanceComponent* UACFDamageCalculation::GetDefenseStanceComponent(const AActor* actor) const
+{
+    if (!actor)
+    {
+        return nullptr;
+    }
+    if (actor == contextReceiver.Get())
+    {
+        return receiverDefenseStance.Get();
+    }
+    return actor->FindComponentByClass<UACFDefenseStanceComponent>();
+}
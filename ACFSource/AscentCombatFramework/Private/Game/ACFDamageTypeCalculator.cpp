@@ -22,7 +22,7 @@ bool UACFDamageTypeCalculator::IsCriticalDamage_Implementation(const FACFDamageE
     if (inDamageEvent.DamageDealer)
     {
         const FDamageInfluence* critChance = CritChancePercentageByParameter.Find(inDamageEvent.DamageClass);
-        const UARSStatisticsComponent* dealerComp = inDamageEvent.DamageDealer->FindComponentByClass<UARSStatisticsComponent>();
+        const UARSStatisticsComponent* dealerComp = GetStatisticsComponent(inDamageEvent.DamageDealer);
 
         // If config found, get the dealer's attribute value and calculate crit %
         if (critChance && dealerComp)
@@ -69,8 +69,8 @@ float UACFDamageTypeCalculator::CalculateFinalDamage_Implementation(const FACFDa
     // Start with the base (raw) damage provided in the event.
     float totalDamage = inDamageEvent.FinalDamage;
 
-    const UARSStatisticsComponent* dealerComp = inDamageEvent.DamageDealer->FindComponentByClass<UARSStatisticsComponent>();
-    UARSStatisticsComponent* receiverComp = inDamageEvent.DamageReceiver->FindComponentByClass<UARSStatisticsComponent>();
+    const UARSStatisticsComponent* dealerComp = GetStatisticsComponent(inDamageEvent.DamageDealer);
+    UARSStatisticsComponent* receiverComp = GetStatisticsComponent(inDamageEvent.DamageReceiver);
 
     // STEP 1: Apply all attacker parameter influences (e.g., Strength, WeaponPower).
     for (const auto& damInf : damagesInf.AttackParametersInfluence)
@@ -99,7 +99,7 @@ float UACFDamageTypeCalculator::CalculateFinalDamage_Implementation(const FACFDa
     }
 
     // STEP 5: Check for defense stance (blocking). If blocking, reduce further.
-    UACFDefenseStanceComponent* defComp = inDamageEvent.DamageReceiver->FindComponentByClass<UACFDefenseStanceComponent>();
+    UACFDefenseStanceComponent* defComp = GetDefenseStanceComponent(inDamageEvent.DamageReceiver);
     FGameplayTag outResponse;
 
     if (defComp && defComp->IsInDefensePosition() && defComp->TryBlockIncomingDamage(inDamageEvent, totalDamage, outResponse))
@@ -128,7 +128,7 @@ float UACFDamageTypeCalculator::CalculateFinalDamage_Implementation(const FACFDa
 
 FGameplayTag UACFDamageTypeCalculator::EvaluateHitResponseAction_Implementation(const FACFDamageEvent& damageEvent, const TArray<FOnHitActionChances>& hitResponseActions)
 {
-    UACFDefenseStanceComponent* defComp = damageEvent.DamageReceiver->FindComponentByClass<UACFDefenseStanceComponent>();
+    UACFDefenseStanceComponent* defComp = GetDefenseStanceComponent(damageEvent.DamageReceiver);
     FGameplayTag outResponse;
 
     if (!damageEvent.DamageDealer)
@@ -163,7 +163,7 @@ FGameplayTag UACFDamageTypeCalculator::EvaluateHitResponseAction_Implementation(
     }
 
     // STEP 4: Handle stagger resistance and heavy hit logic.
-    UARSStatisticsComponent* receiverComp = damageEvent.DamageReceiver->FindComponentByClass<UARSStatisticsComponent>();
+    UARSStatisticsComponent* receiverComp = GetStatisticsComponent(damageEvent.DamageReceiver);
     UACFDamageType* DamageType = GetDamageType(damageEvent);
     if (receiverComp && DamageType && StaggerResistanceStastistic != FGameplayTag() && outResponse == UACFFunctionLibrary::GetDefaultHitState())
     {
@@ -117,14 +117,36 @@ private:
     void ConstructDamageReceived(AActor* DamagedActor, float Damage, class AController* InstigatedBy, FVector HitLocation,
         class UPrimitiveComponent* FHitComponent, FName BoneName, FVector ShotFromDirection, TSubclassOf<UDamageType> DamageType, AActor* DamageCauser);
 
-    /** Called on all clients when this character receives damage. */
-    UFUNCTION(NetMulticast, Reliable, Category = ACF)
-    void ClientsReceiveDamage(const FACFDamageEvent& damageEvent);
+    /**
+     * Called on the clients the character is relevant to, with all the hits received during a frame.
+     * The server broadcasts the full damage events as soon as they happen.
+     */
+    UFUNCTION(NetMulticast, Unreliable, Category = ACF)
+    void ClientsReceiveDamageBatch(const TArray<FACFCompactDamageEvent>& damageEvents);
+
+    /** Queues the compact form of LastDamageReceived, sent once per frame. */
+    void QueueClientsDamage();
+
+    /** Sends the hits queued during this frame. */
+    void FlushClientsDamage();
+
+    /** Rebuilds a damage event on the clients from its compact form. */
+    FACFDamageEvent ExpandDamageEvent(const FACFCompactDamageEvent& compactEvent) const;
+
+    /** Hits received during this frame, not yet sent to the clients. */
+    TArray<FACFCompactDamageEvent> pendingClientsDamage;
 
     /** Instance of the damage calculator used to evaluate hit responses and final damage. */
     UPROPERTY()
     class UACFDamageCalculation* DamageCalculator;
 
+    /** Statistics component of the owner, cached at BeginPlay. */
+    UPROPERTY()
+    class UARSStatisticsComponent* statisticsComp;
+
+    /** Creates the damage calculator if needed and caches the owner's damage context in it. */
+    void InitializeDamageCalculator();
+
     /** The last damage event data received and processed by this component. */
     UPROPERTY()
     FACFDamageEvent LastDamageReceived;
@@ -66,6 +66,30 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = ACF)
     bool bAutoEnableOnBeginPlay = false;
 
+    /*Weight of the distance from the pawn in the candidate score, closer scores higher*/
+    UPROPERTY(EditDefaultsOnly, Category = "ACF | Scoring")
+    float DistanceWeight = 1.f;
+
+    /*Weight of the view angle in the candidate score, candidates in front of the camera score higher*/
+    UPROPERTY(EditDefaultsOnly, Category = "ACF | Scoring")
+    float ViewAngleWeight = 1.f;
+
+    /*Weight of the interactable's own priority in the candidate score*/
+    UPROPERTY(EditDefaultsOnly, Category = "ACF | Scoring")
+    float PriorityWeight = 1.f;
+
+    /*The candidates are scored again only when the view moves more than this distance*/
+    UPROPERTY(EditDefaultsOnly, Category = "ACF | Scoring")
+    float RescoreDistanceThreshold = 20.f;
+
+    /*The candidates are scored again only when the view rotates more than these degrees*/
+    UPROPERTY(EditDefaultsOnly, Category = "ACF | Scoring")
+    float RescoreAngleThreshold = 5.f;
+
+    /*Seconds between two checks of CanBeInteracted on the candidates while the view is still*/
+    UPROPERTY(EditDefaultsOnly, Category = "ACF | Scoring")
+    float RevalidationInterval = 0.25f;
+
 public:
     // Called every frame
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -85,8 +109,29 @@ private:
     UPROPERTY(Transient)
     class AActor* currentBestInteractableActor;
 
-    UPROPERTY()
-    TArray<class AActor*> interactables;
+    /*An interactable inside the detector*/
+    struct FACFInteractionCandidate {
+        TWeakObjectPtr<AActor> Actor;
+        float Score = 0.f;
+    };
+
+    /*Interactables inside the detector, sorted by descending score*/
+    TArray<FACFInteractionCandidate> candidates;
+
+    FVector lastScoredViewLocation = FVector::ZeroVector;
+
+    FRotator lastScoredViewRotation = FRotator::ZeroRotator;
+
+    float timeSinceRevalidation = 0.f;
+
+    void ScoreCandidates();
+
+    float ComputeScore(const AActor* actor, const FVector& viewLocation, const FVector& viewDirection) const;
+
+    void SelectBestCandidate();
+
+    /*Ticks only while there are candidates to track, on the instance controlling the pawn*/
+    void UpdateTickState();
 
     UFUNCTION()
     void UpdateInteractionArea();
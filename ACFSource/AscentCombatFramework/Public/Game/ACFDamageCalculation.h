@@ -8,6 +8,8 @@
 #include "ACFDamageCalculation.generated.h"
 
 struct FACFDamageEvent;
+class UARSStatisticsComponent;
+class UACFDefenseStanceComponent;
 
 /**
  * Base class for damage calculation logic in the Ascent Combat Framework (ACF).
@@ -92,4 +94,28 @@ public:
      */
     UFUNCTION(BlueprintPure, Category = ACF)
     UACFDamageType* GetDamageType(const FACFDamageEvent& inDamageEvent);
+
+    /**
+     * Caches the components of the actor receiving damage through this calculator,
+     * so that resolving a hit doesn't search the receiver's components.
+     * Called by the damage handler that owns this calculator.
+     *
+     * @param damageReceiver - The owner of the damage handler.
+     */
+    virtual void InitializeDamageContext(AActor* damageReceiver);
+
+protected:
+    /** Returns the statistics component of the actor, cached for the receiver and read directly from ACF characters. */
+    UARSStatisticsComponent* GetStatisticsComponent(const AActor* actor) const;
+
+    /** Returns the defense stance component of the actor, cached for the receiver. */
+    UACFDefenseStanceComponent* GetDefenseStanceComponent(const AActor* actor) const;
+
+private:
+    /** Damage context cached by InitializeDamageContext */
+    TWeakObjectPtr<const AActor> contextReceiver;
+
+    TWeakObjectPtr<UARSStatisticsComponent> receiverStatistics;
+
+    TWeakObjectPtr<UACFDefenseStanceComponent> receiverDefenseStance;
 };
\ No newline at end of file
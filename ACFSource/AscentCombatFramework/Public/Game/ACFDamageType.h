@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/DamageType.h"
 #include <Engine/EngineTypes.h>
+#include <Engine/NetSerialization.h>
 #include "GameplayTagContainer.h"
 
 #include "ACFDamageType.generated.h"
@@ -240,4 +241,50 @@ struct FACFDamageEvent {
      */
     UPROPERTY(BlueprintReadWrite, Category = ACF)
     FGameplayTagContainer DamageTags;
-};
\ No newline at end of file
+};
+
+/**
+ * Compact form of FACFDamageEvent sent to clients.
+ *
+ * The hit is quantized and everything the clients can rebuild on their own is left out:
+ * the receiver is the owner of the damage handler, the damage tags come from the damage class
+ * and the physical material from the hit bone.
+ */
+USTRUCT()
+struct FACFCompactDamageEvent {
+    GENERATED_BODY()
+
+    /** Hit location, rounded to 1/10 of a unit */
+    UPROPERTY()
+    FVector_NetQuantize10 ImpactPoint;
+
+    /** Normalized hit direction */
+    UPROPERTY()
+    FVector_NetQuantizeNormal HitDirection;
+
+    /** Replicated as a NetGUID, its tags are read from the CDO on the clients */
+    UPROPERTY()
+    TSubclassOf<class UACFDamageType> DamageClass;
+
+    UPROPERTY()
+    TObjectPtr<AActor> DamageDealer = nullptr;
+
+    UPROPERTY()
+    FGameplayTag HitResponseAction;
+
+    UPROPERTY()
+    float FinalDamage = 0.f;
+
+    /** Index of the hit bone in the receiver's mesh, INDEX_NONE if none */
+    UPROPERTY()
+    int16 BoneIndex = INDEX_NONE;
+
+    UPROPERTY()
+    EDamageZone DamageZone = EDamageZone::ENormal;
+
+    UPROPERTY()
+    EACFDirection DamageDirection = EACFDirection::Front;
+
+    UPROPERTY()
+    bool bIsCritical = false;
+};
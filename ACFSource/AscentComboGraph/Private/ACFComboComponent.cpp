@@ -33,8 +33,7 @@ void UACFComboComponent::StartCombo_Implementation(UACFComboGraph* comboToStart,
         StopCurrentCombo();
     }
     if ( comboToStart) {
-        FActionState action;
-        if (actionsComp->GetActionByTag(triggeringAction, action)) {
+        if (actionsComp->FindActionByTag(triggeringAction)) {
             currentCombo = comboToStart; /* DuplicateObject<UACFComboGraph>(comboToStart, GetOuter());   */           
             currentCombo->StartCombo(triggeringAction);
             bIsPerformingCombo = currentCombo->IsActive();
@@ -4,6 +4,7 @@
 
 #include "ACFCoreTypes.h"
 #include "CoreMinimal.h"
+#include <GameFramework/Actor.h>
 #include <UObject/Interface.h>
 #include "ACFInteractableInterface.generated.h"
 
@@ -46,4 +47,19 @@ public:
 		return true;
 	}
 
+	/*Added to the score of this interactable when the pawn picks the best one around, higher wins*/
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = ACF)
+	float GetInteractionPriority(class APawn* Pawn) const;
+	virtual float GetInteractionPriority_Implementation(class APawn* Pawn) const {
+		return 0.f;
+	}
+
+	/*Point used to score this interactable from the pawn view, actors spanning a large area return the part closest to it*/
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = ACF)
+	FVector GetInteractionLocation(const FVector& viewLocation) const;
+	virtual FVector GetInteractionLocation_Implementation(const FVector& viewLocation) const {
+		const AActor* actor = Cast<AActor>(_getUObject());
+		return actor ? actor->GetActorLocation() : viewLocation;
+	}
+
 };
@@ -51,7 +51,7 @@ UAGSGraphNode* UADSDialogue::StartDialogue(class APlayerController* inController
 
 bool UADSDialogue::ActivateNode(class UAGSGraphNode* node)
 {
-    if (node && AllNodes.Contains(node)) {
+    if (ContainsNode(node)) {
         if (currentNode) {
             currentNode->DeactivateNode();
         }
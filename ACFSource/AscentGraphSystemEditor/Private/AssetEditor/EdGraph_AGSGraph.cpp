@@ -117,6 +117,8 @@ void UEdGraph_AGSGraph::RebuildAGSGraph()
 		UEdNode_AGSGraphNode* EdNode_RNode = NodeMap[&R];
 		return EdNode_LNode->NodePosX < EdNode_RNode->NodePosX;
 	});
+
+	Graph->CompileGraph();
 }
 
 UAGSGraph* UEdGraph_AGSGraph::GetAGSGraph() const
@@ -3,6 +3,7 @@
 #include "AGSGraph.h"
 #include "AGSGraphRuntimePCH.h"
 #include "Engine/Engine.h"
+#include "UObject/ObjectSaveContext.h"
 
 #define LOCTEXT_NAMESPACE "AGSGraph"
 
@@ -58,7 +59,7 @@ void UAGSGraph::Print(bool ToConsole /*= true*/, bool ToScreen /*= true*/)
 
 bool UAGSGraph::ActivateNode(UAGSGraphNode* node)
 {
-    if (node && AllNodes.Contains(node)) {
+    if (ContainsNode(node)) {
         ActivedNodes.AddUnique(node);
         node->ActivateNode();
         return true;
@@ -68,7 +69,7 @@ bool UAGSGraph::ActivateNode(UAGSGraphNode* node)
 
 bool UAGSGraph::DeactivateNode(UAGSGraphNode* node)
 {
-    if (node && AllNodes.Contains(node)) {
+    if (ContainsNode(node)) {
         node->DeactivateNode();
         ActivedNodes.Remove(node);
 
@@ -87,55 +88,153 @@ void UAGSGraph::DeactivateAllNodes()
 
 int UAGSGraph::GetLevelNum() const
 {
+    if (!IsGraphCompiled()) {
+        const_cast<UAGSGraph*>(this)->CompileGraph();
+    }
+    return FMath::Max(CompiledLevelOffsets.Num() - 1, 0);
+}
 
-    int Level = 0;
-    TArray<UAGSGraphNode*> CurrLevelNodes = RootNodes;
-    TArray<UAGSGraphNode*> NextLevelNodes;
+void UAGSGraph::GetNodesByLevel(int Level, TArray<UAGSGraphNode*>& Nodes)
+{
+    if (!IsGraphCompiled()) {
+        CompileGraph();
+    }
 
-    while (CurrLevelNodes.Num() != 0) {
-        for (int i = 0; i < CurrLevelNodes.Num(); ++i) {
-            UAGSGraphNode* Node = CurrLevelNodes[i];
-            check(Node != nullptr);
+    Nodes.Reset();
+    for (const int32 nodeIndex : GetNodeIndicesByLevel(Level)) {
+        Nodes.Add(AllNodes[nodeIndex]);
+    }
+}
 
-            for (int j = 0; j < Node->ChildrenNodes.Num(); ++j) {
-                NextLevelNodes.Add(Node->ChildrenNodes[j]);
-            }
-        }
+UAGSGraphNode* UAGSGraph::FindNodeByTag(const FGameplayTag& nodeTag) const
+{
+    if (!IsGraphCompiled()) {
+        const_cast<UAGSGraph*>(this)->CompileGraph();
+    }
 
-        CurrLevelNodes = NextLevelNodes;
-        NextLevelNodes.Reset();
-        ++Level;
+    const int32* nodeIndex = CompiledTagIndices.Find(nodeTag);
+    if (nodeIndex && AllNodes.IsValidIndex(*nodeIndex) && AllNodes[*nodeIndex] && AllNodes[*nodeIndex]->GetNodeTag() == nodeTag) {
+        return AllNodes[*nodeIndex];
     }
 
-    return Level;
+#if WITH_EDITOR
+    // tags edited in the details panel don't recompile the graph until it's saved
+    for (UAGSGraphNode* node : AllNodes) {
+        if (node && node->GetNodeTag() == nodeTag) {
+            return node;
+        }
+    }
+#endif
+    return nullptr;
 }
 
-void UAGSGraph::GetNodesByLevel(int Level, TArray<UAGSGraphNode*>& Nodes)
+bool UAGSGraph::ContainsNode(const UAGSGraphNode* node) const
 {
-    int CurrLEvel = 0;
-    TArray<UAGSGraphNode*> NextLevelNodes;
+    if (!node) {
+        return false;
+    }
+    if (AllNodes.IsValidIndex(node->NodeIndex) && AllNodes[node->NodeIndex] == node) {
+        return true;
+    }
+    // not compiled yet
+    return !IsGraphCompiled() && AllNodes.Contains(node);
+}
 
-    Nodes = RootNodes;
+TConstArrayView<int32> UAGSGraph::GetChildIndices(int32 nodeIndex) const
+{
+    if (!IsGraphCompiled() || !AllNodes.IsValidIndex(nodeIndex)) {
+        return TConstArrayView<int32>();
+    }
+    const int32 start = CompiledChildOffsets[nodeIndex];
+    return TConstArrayView<int32>(CompiledChildIndices.GetData() + start, CompiledChildOffsets[nodeIndex + 1] - start);
+}
 
-    while (Nodes.Num() != 0) {
-        if (CurrLEvel == Level)
-            break;
+TConstArrayView<int32> UAGSGraph::GetNodeIndicesByLevel(int32 level) const
+{
+    if (level < 0 || level >= CompiledLevelOffsets.Num() - 1) {
+        return TConstArrayView<int32>();
+    }
+    const int32 start = CompiledLevelOffsets[level];
+    return TConstArrayView<int32>(CompiledLevelNodes.GetData() + start, CompiledLevelOffsets[level + 1] - start);
+}
 
-        for (int i = 0; i < Nodes.Num(); ++i) {
-            UAGSGraphNode* Node = Nodes[i];
-            check(Node != nullptr);
+void UAGSGraph::CompileGraph()
+{
+    const int32 nodeNum = AllNodes.Num();
+    for (int32 index = 0; index < nodeNum; ++index) {
+        if (AllNodes[index]) {
+            AllNodes[index]->NodeIndex = index;
+        }
+    }
 
-            for (int j = 0; j < Node->ChildrenNodes.Num(); ++j) {
-                NextLevelNodes.Add(Node->ChildrenNodes[j]);
+    // children, contiguous per node
+    CompiledChildIndices.Reset();
+    CompiledChildOffsets.Reset(nodeNum + 1);
+    for (const UAGSGraphNode* node : AllNodes) {
+        CompiledChildOffsets.Add(CompiledChildIndices.Num());
+        if (node) {
+            for (const UAGSGraphNode* child : node->ChildrenNodes) {
+                if (child && AllNodes.IsValidIndex(child->NodeIndex) && AllNodes[child->NodeIndex] == child) {
+                    CompiledChildIndices.Add(child->NodeIndex);
+                }
             }
         }
-
-        Nodes = NextLevelNodes;
-        NextLevelNodes.Reset();
-        ++CurrLEvel;
+    }
+    CompiledChildOffsets.Add(CompiledChildIndices.Num());
+
+    // levels: breadth first from the roots, each node is placed at its shallowest level so cycles are fine
+    TBitArray<> visited(false, nodeNum);
+    CompiledLevelNodes.Reset(nodeNum);
+    CompiledLevelOffsets.Reset();
+    for (const UAGSGraphNode* root : RootNodes) {
+        if (root && AllNodes.IsValidIndex(root->NodeIndex) && !visited[root->NodeIndex]) {
+            visited[root->NodeIndex] = true;
+            CompiledLevelNodes.Add(root->NodeIndex);
+        }
+    }
+    int32 levelStart = 0;
+    while (levelStart < CompiledLevelNodes.Num()) {
+        CompiledLevelOffsets.Add(levelStart);
+        const int32 levelEnd = CompiledLevelNodes.Num();
+        for (int32 position = levelStart; position < levelEnd; ++position) {
+            for (const int32 childIndex : GetChildIndices(CompiledLevelNodes[position])) {
+                if (!visited[childIndex]) {
+                    visited[childIndex] = true;
+                    CompiledLevelNodes.Add(childIndex);
+                }
+            }
+        }
+        levelStart = levelEnd;
+    }
+    CompiledLevelOffsets.Add(CompiledLevelNodes.Num());
+
+    // tags, the first node wins like a linear search would
+    CompiledTagIndices.Reset();
+    for (int32 index = 0; index < nodeNum; ++index) {
+        const FGameplayTag nodeTag = AllNodes[index] ? AllNodes[index]->GetNodeTag() : FGameplayTag();
+        if (nodeTag.IsValid() && !CompiledTagIndices.Contains(nodeTag)) {
+            CompiledTagIndices.Add(nodeTag, index);
+        }
     }
 }
 
+void UAGSGraph::PostLoad()
+{
+    Super::PostLoad();
+
+    // linear and cheap, rebuilding on every load keeps the tables in sync with edits never saved through PreSave
+    CompileGraph();
+}
+
+#if WITH_EDITOR
+void UAGSGraph::PreSave(FObjectPreSaveContext SaveContext)
+{
+    Super::PreSave(SaveContext);
+
+    CompileGraph();
+}
+#endif
+
 void UAGSGraph::ClearGraph()
 {
     for (int i = 0; i < AllNodes.Num(); ++i) {
@@ -148,6 +247,11 @@ void UAGSGraph::ClearGraph()
 
     AllNodes.Empty();
     RootNodes.Empty();
+    CompiledChildIndices.Empty();
+    CompiledChildOffsets.Empty();
+    CompiledLevelNodes.Empty();
+    CompiledLevelOffsets.Empty();
+    CompiledTagIndices.Empty();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -11,6 +11,7 @@
 #include "AGSGraph.generated.h"
 
 class UEdGraph;
+class FObjectPreSaveContext;
 
 
 UCLASS(Blueprintable)
@@ -80,8 +81,40 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AGSGraph")
     void GetNodesByLevel(int Level, TArray<UAGSGraphNode*>& Nodes);
 
+    /** Returns the first node whose GetNodeTag matches the provided tag. */
+    UFUNCTION(BlueprintCallable, Category = "AGSGraph")
+    UAGSGraphNode* FindNodeByTag(const FGameplayTag& nodeTag) const;
+
+    /** Returns whether the node belongs to this graph. */
+    bool ContainsNode(const UAGSGraphNode* node) const;
+
+    /** Indices in AllNodes of the children of the node at the provided index. */
+    TConstArrayView<int32> GetChildIndices(int32 nodeIndex) const;
+
+    /** Indices in AllNodes of the nodes at the provided level, roots are level 0. */
+    TConstArrayView<int32> GetNodeIndicesByLevel(int32 level) const;
+
     void ClearGraph();
 
+    /**
+     * Flattens the graph in index tables: children of each node, nodes by level and nodes by tag.
+     * Runs when the editor rebuilds the graph and when the asset is saved or cooked,
+     * graph types override it to precompute their own runtime data.
+     */
+    virtual void CompileGraph();
+
+    /** Whether the compiled tables match the current nodes. */
+    bool IsGraphCompiled() const
+    {
+        return CompiledChildOffsets.Num() == AllNodes.Num() + 1;
+    }
+
+    virtual void PostLoad() override;
+
+#if WITH_EDITOR
+    virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+#endif
+
     UFUNCTION(BlueprintPure, Category = "AGSGraph")
     class APlayerController* GetPlayerController() const
     {
@@ -99,4 +132,23 @@ public:
 private:
     UPROPERTY()
     TArray<UAGSGraphNode*> ActivedNodes;
+
+    /** Children of all the nodes, contiguous per node */
+    UPROPERTY()
+    TArray<int32> CompiledChildIndices;
+
+    /** Start of the children of each node in CompiledChildIndices, with a final end entry */
+    UPROPERTY()
+    TArray<int32> CompiledChildOffsets;
+
+    /** Reachable nodes in breadth first order, hence grouped by level */
+    UPROPERTY()
+    TArray<int32> CompiledLevelNodes;
+
+    /** Start of each level in CompiledLevelNodes, with a final end entry */
+    UPROPERTY()
+    TArray<int32> CompiledLevelOffsets;
+
+    UPROPERTY()
+    TMap<FGameplayTag, int32> CompiledTagIndices;
 };
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
 #include "Templates/SubclassOf.h"
 #include "AGSGraphNode.generated.h"
 
@@ -33,6 +34,9 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = AGS)
 	ENodeState NodeState = ENodeState::Disabled;
 
+	UPROPERTY()
+	int32 NodeIndex = INDEX_NONE;
+
 public:
 
 	UAGSGraphNode();
@@ -59,6 +63,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = AGS)
 	UAGSGraph* GetGraph() const;
 
+	/** Index of this node in the AllNodes array of its graph, assigned when the graph is compiled */
+	int32 GetNodeIndex() const
+	{
+		return NodeIndex;
+	}
+
+	/** Tag used to look this node up in its graph, see UAGSGraph::FindNodeByTag */
+	virtual FGameplayTag GetNodeTag() const
+	{
+		return FGameplayTag();
+	}
+
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = AGS)
 	FText GetDescription() const;
 	virtual FText GetDescription_Implementation() const;
@@ -10,6 +10,7 @@ AAMSActorMarker::AAMSActorMarker()
  	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
 	PrimaryActorTick.bCanEverTick = false;
 	MarkerComp = CreateDefaultSubobject<UAMSMapMarkerComponent>(TEXT("Marker Comp"));
+	MarkerComp->SetMarkerUpdateMode(EAMSMarkerUpdateMode::EStatic);
 }
 
 // Called when the game starts or when spawned
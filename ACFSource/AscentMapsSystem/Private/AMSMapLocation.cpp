@@ -2,8 +2,10 @@
 
 #include "AMSMapLocation.h"
 #include "AMSMapMarkerComponent.h"
+#include "AMSMapSubsystem.h"
 #include "Components/SphereComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include <Engine/GameInstance.h>
 #include <GameFramework/Pawn.h>
 
 // Sets default values
@@ -13,6 +15,7 @@ AAMSMapLocation::AAMSMapLocation()
     PrimaryActorTick.bCanEverTick = false;
     SphereComp = CreateDefaultSubobject<USphereComponent>(TEXT("Discover Area"));
     MarkerComp = CreateDefaultSubobject<UAMSMapMarkerComponent>(TEXT("Marker Componenr"));
+    MarkerComp->SetMarkerUpdateMode(EAMSMarkerUpdateMode::EStatic);
     SphereComp->SetSphereRadius(2000.f);
 }
 
@@ -24,6 +27,9 @@ FString AAMSMapLocation::GetLocationName() const
 void AAMSMapLocation::SetLocationName(const FString& newName)
 {
     GetMarkerComponent()->SetMarkerName(newName);
+    if (UAMSMapSubsystem* mapSubsystem = GetMapSubsystem()) {
+        mapSubsystem->NotifyLocationRenamed(this);
+    }
 }
 
 void AAMSMapLocation::SetDiscoveredState(bool newState)
@@ -35,6 +41,9 @@ void AAMSMapLocation::SetDiscoveredState(bool newState)
     } else {
         MarkerComp->RemoveMarker();
     }
+    if (UAMSMapSubsystem* mapSubsystem = GetMapSubsystem()) {
+        mapSubsystem->NotifyLocationDiscoveredChanged(this);
+    }
 }
 
 // Called when the game starts or when spawned
@@ -46,6 +55,24 @@ void AAMSMapLocation::BeginPlay()
     } else {
         SphereComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
     }
+
+    if (UAMSMapSubsystem* mapSubsystem = GetMapSubsystem()) {
+        mapSubsystem->RegisterLocation(this);
+    }
+}
+
+void AAMSMapLocation::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UAMSMapSubsystem* mapSubsystem = GetMapSubsystem()) {
+        mapSubsystem->UnregisterLocation(this);
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
+UAMSMapSubsystem* AAMSMapLocation::GetMapSubsystem() const
+{
+    const UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(this);
+    return GameInstance ? GameInstance->GetSubsystem<UAMSMapSubsystem>() : nullptr;
 }
 
 void AAMSMapLocation::OnDiscovered_Implementation()
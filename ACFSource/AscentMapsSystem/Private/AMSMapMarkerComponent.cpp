@@ -11,9 +11,10 @@
 /*Sets default values for this component's properties*/
 UAMSMapMarkerComponent::UAMSMapMarkerComponent()
 {
-    // Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-    // off to improve performance if you don't need them.
+    // The tick is only enabled by UpdateTickState when the world widget is displayed
+    // or a dynamic marker needs to sync its position with the map, at a lower rate while no map is open
     PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
     SetHiddenInGame(true, true);
     /*SetVisibility(false);*/
 }
@@ -23,12 +24,13 @@ void UAMSMapMarkerComponent::BeginPlay()
 {
     Super::BeginPlay();
     originalCategory = MarkerCategory;
+    cachedMapSubsystem = GetMapSubsystem();
     iconWidget = Cast<UAMSMarkerWidget>( GetWidget());
 
     if (IsValid(iconWidget)) {
         iconWidget->SetupMarkerIcon(this);
     }
-    // ...
+    UpdateTickState();
 }
 
 void UAMSMapMarkerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -39,6 +41,85 @@ void UAMSMapMarkerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
     Super::EndPlay(EndPlayReason);
 }
 
+void UAMSMapMarkerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    /*The widget component tick only matters when the world widget is rendered*/
+    if (bWorldWidgetTick) {
+        Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    }
+
+    if (bPositionSyncTick) {
+        positionSyncTimer += DeltaTime;
+        if (positionSyncTimer >= positionSyncInterval) {
+            positionSyncTimer = 0.f;
+            SyncPosition(false);
+        }
+    }
+}
+
+void UAMSMapMarkerComponent::UpdateTickState()
+{
+    if (!HasBegunPlay()) {
+        return;
+    }
+
+    const UAMSMapSubsystem* mapSubsystem = GetMapSubsystem();
+    const bool bMarked = mapSubsystem && mapSubsystem->IsMarkerActive(this);
+    const bool bNeedsPositionSync = bMarked && MarkerUpdateMode == EAMSMarkerUpdateMode::EDynamic;
+    /*Nobody looks at the map, keep the subsystem queries roughly valid at a lower rate*/
+    const bool bLowRate = bNeedsPositionSync && !bUpdateWhenMapClosed && !mapSubsystem->IsAnyMapOpen();
+
+    if (bNeedsPositionSync && (!bPositionSyncTick || (bLowRatePositionSync && !bLowRate))) {
+        /*The map may have missed the last moves while the sync was off or slowed down*/
+        SyncPosition(true);
+    }
+
+    bWorldWidgetTick = bMarked && bActivateWorldWidget;
+    bPositionSyncTick = bNeedsPositionSync;
+    bLowRatePositionSync = bLowRate;
+    positionSyncInterval = bLowRate ? FMath::Max(ClosedMapPositionUpdateInterval, PositionUpdateInterval) : PositionUpdateInterval;
+    positionSyncTimer = 0.f;
+
+    /*Without a world widget there's no reason to tick more often than the sync interval*/
+    SetComponentTickInterval(bWorldWidgetTick ? 0.f : positionSyncInterval);
+    SetComponentTickEnabled(bWorldWidgetTick || bPositionSyncTick);
+}
+
+void UAMSMapMarkerComponent::UpdateMarkerPosition()
+{
+    SyncPosition(true);
+}
+
+void UAMSMapMarkerComponent::SyncPosition(bool bForce)
+{
+    UAMSMapSubsystem* mapSubsystem = GetMapSubsystem();
+    if (!mapSubsystem || !GetOwner()) {
+        return;
+    }
+
+    const FVector ownerLoc = GetOwnerLocation();
+    const float ownerYaw = GetOwnerRotation().Yaw;
+    const bool bMoved = FVector::DistSquared2D(ownerLoc, lastSyncedLocation) > FMath::Square(PositionUpdateThreshold);
+    const bool bRotated = bShouldRotate && !FMath::IsNearlyEqual(ownerYaw, lastSyncedYaw, 1.f);
+    if (bForce || bMoved || bRotated) {
+        lastSyncedLocation = ownerLoc;
+        lastSyncedYaw = ownerYaw;
+        mapSubsystem->NotifyMarkerMoved(this);
+    }
+}
+
+void UAMSMapMarkerComponent::SetActivateWorldWidget(bool val)
+{
+    bActivateWorldWidget = val;
+    UpdateTickState();
+}
+
+void UAMSMapMarkerComponent::SetMarkerUpdateMode(EAMSMarkerUpdateMode val)
+{
+    MarkerUpdateMode = val;
+    UpdateTickState();
+}
+
 void UAMSMapMarkerComponent::AddMarker()
 {
     UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(this);
@@ -57,6 +138,21 @@ void UAMSMapMarkerComponent::RemoveMarker()
     }
 }
 
+void UAMSMapMarkerComponent::SetMarkerCategory(FGameplayTag val)
+{
+    const FGameplayTag oldCategory = MarkerCategory;
+    MarkerCategory = val;
+    UAMSMapSubsystem* subsystem = GetMapSubsystem();
+    if (subsystem && oldCategory != MarkerCategory) {
+        subsystem->NotifyMarkerCategoryChanged(this, oldCategory);
+    }
+}
+
+void UAMSMapMarkerComponent::RestoreMarkerCatgory()
+{
+    SetMarkerCategory(originalCategory);
+}
+
 FVector UAMSMapMarkerComponent::GetOwnerLocation() const
 {
     return GetOwner()->GetActorLocation();
@@ -77,3 +173,12 @@ FRotator UAMSMapMarkerComponent::GetOwnerRotation() const
 {
     return GetOwner()->GetActorRotation();
 }
+
+UAMSMapSubsystem* UAMSMapMarkerComponent::GetMapSubsystem() const
+{
+    if (cachedMapSubsystem.IsValid()) {
+        return cachedMapSubsystem.Get();
+    }
+    const UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(this);
+    return GameInstance ? GameInstance->GetSubsystem<UAMSMapSubsystem>() : nullptr;
+}
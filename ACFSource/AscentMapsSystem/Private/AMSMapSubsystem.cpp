@@ -9,6 +9,13 @@
 #include "AMSMapLocation.h"
 #include "AMSDeveloperSettings.h"
 #include "AMSMarkerWidget.h"
+#include "EngineDefines.h"
+
+namespace AMSMapSubsystemConstants {
+    /*Markers are indexed on the XY plane, anything outside this range is clamped on the border*/
+    constexpr float TreeHalfSize = HALF_WORLD_MAX;
+    constexpr float TreeMinimumQuadSize = 1000.f;
+}
 
 
  UAMSMapSubsystem::UAMSMapSubsystem()
@@ -16,6 +23,28 @@
      bHasMarkerTracked = false;
  }
 
+void UAMSMapSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    const FVector2D treeExtent(AMSMapSubsystemConstants::TreeHalfSize);
+    MarkersTree = MakeUnique<TQuadTree<UAMSMapMarkerComponent*, 16>>(FBox2D(-treeExtent, treeExtent), AMSMapSubsystemConstants::TreeMinimumQuadSize);
+}
+
+void UAMSMapSubsystem::Deinitialize()
+{
+    MarkersTree.Reset();
+    Markers.Empty();
+    MarkerIndices.Empty();
+    MarkerPositions.Empty();
+    MarkersByCategory.Empty();
+    Locations.Empty();
+    LocationNames.Empty();
+    LocationIndices.Empty();
+    LocationsByName.Empty();
+    DiscoveredLocations.Empty();
+    Super::Deinitialize();
+}
+
 void UAMSMapSubsystem::RegisterMapArea(const FName& tag, TObjectPtr<class AAMSMapArea> map)
 {
     Maps.Add(tag, map);
@@ -29,26 +58,154 @@ void UAMSMapSubsystem::RegisterPlayerInArea(const FName& tag, int32 priority)
 
 void UAMSMapSubsystem::RegisterMarker(class UAMSMapMarkerComponent* markerComp)
 {
-    if (markerComp && !Markers.Contains(markerComp)) {
-        Markers.AddUnique(markerComp);
+    if (markerComp && !MarkerIndices.Contains(markerComp)) {
+        MarkerIndices.Add(markerComp, Markers.Add(markerComp));
+        const FVector2D treePos = GetMarkerTreePosition(markerComp);
+        MarkerPositions.Add(treePos);
+        MarkersByCategory.FindOrAdd(markerComp->GetMarkerCategory()).Add(markerComp);
+        if (MarkersTree) {
+            MarkersTree->Insert(markerComp, FBox2D(treePos, treePos));
+        }
         if (markerComp->GetActivateWorldWidget()) {
             markerComp->SetHiddenInGame(false, true);
         }
+        markerComp->UpdateTickState();
         OnMapMarkerAdded.Broadcast(markerComp);
     }
 }
 
 void UAMSMapSubsystem::RemoveMarker(class UAMSMapMarkerComponent* markerComp)
 {
-    if (Markers.Contains(markerComp)) {
-        Markers.Remove(markerComp);
+    int32 index;
+    if (MarkerIndices.RemoveAndCopyValue(markerComp, index)) {
+        const FVector2D treePos = MarkerPositions[index];
+        if (MarkersTree) {
+            MarkersTree->Remove(markerComp, FBox2D(treePos, treePos));
+        }
+        Markers.RemoveAtSwap(index);
+        MarkerPositions.RemoveAtSwap(index);
+        if (Markers.IsValidIndex(index)) {
+            MarkerIndices.FindChecked(Markers[index]) = index;
+        }
+        if (TArray<TObjectPtr<UAMSMapMarkerComponent>>* categoryMarkers = MarkersByCategory.Find(markerComp->GetMarkerCategory())) {
+            categoryMarkers->RemoveSingleSwap(markerComp);
+        }
         if (markerComp->GetActivateWorldWidget()) {
             markerComp->SetHiddenInGame(true, true);
         }
+        markerComp->UpdateTickState();
         OnMapMarkerRemoved.Broadcast(markerComp);
     }
 }
 
+void UAMSMapSubsystem::NotifyMarkerMoved(class UAMSMapMarkerComponent* markerComp)
+{
+    const int32* index = MarkerIndices.Find(markerComp);
+    if (!index) {
+        return;
+    }
+
+    const FVector2D newPos = GetMarkerTreePosition(markerComp);
+    FVector2D& treePos = MarkerPositions[*index];
+    if (newPos.Equals(treePos)) {
+        /*Rotation only*/
+        OnMapMarkerMovedNative.Broadcast(markerComp);
+        return;
+    }
+
+    if (MarkersTree) {
+        MarkersTree->Remove(markerComp, FBox2D(treePos, treePos));
+        MarkersTree->Insert(markerComp, FBox2D(newPos, newPos));
+    }
+    treePos = newPos;
+    OnMapMarkerMovedNative.Broadcast(markerComp);
+}
+
+void UAMSMapSubsystem::RegisterMapViewer()
+{
+    MapViewers++;
+    if (MapViewers == 1) {
+        UpdateDynamicMarkersTickState();
+    }
+}
+
+void UAMSMapSubsystem::UnregisterMapViewer()
+{
+    if (MapViewers > 0) {
+        MapViewers--;
+        if (MapViewers == 0) {
+            UpdateDynamicMarkersTickState();
+        }
+    }
+}
+
+void UAMSMapSubsystem::UpdateDynamicMarkersTickState()
+{
+    for (UAMSMapMarkerComponent* markerComp : Markers) {
+        if (IsValid(markerComp) && markerComp->GetMarkerUpdateMode() == EAMSMarkerUpdateMode::EDynamic) {
+            markerComp->UpdateTickState();
+        }
+    }
+}
+
+void UAMSMapSubsystem::NotifyMarkerCategoryChanged(class UAMSMapMarkerComponent* markerComp, const FGameplayTag& oldCategory)
+{
+    if (!MarkerIndices.Contains(markerComp)) {
+        return;
+    }
+    if (TArray<TObjectPtr<UAMSMapMarkerComponent>>* categoryMarkers = MarkersByCategory.Find(oldCategory)) {
+        categoryMarkers->RemoveSingleSwap(markerComp);
+    }
+    MarkersByCategory.FindOrAdd(markerComp->GetMarkerCategory()).Add(markerComp);
+}
+
+TArray<UAMSMapMarkerComponent*> UAMSMapSubsystem::GetMarkersInArea(const FVector2D& areaMin, const FVector2D& areaMax, const FGameplayTagContainer& categories) const
+{
+    TArray<UAMSMapMarkerComponent*> outMarkers;
+    QueryMarkersInArea(FBox2D(areaMin, areaMax), categories, outMarkers);
+    return outMarkers;
+}
+
+TArray<UAMSMapMarkerComponent*> UAMSMapSubsystem::GetMarkersInRadius(const FVector& center, float radius, const FGameplayTagContainer& categories) const
+{
+    TArray<UAMSMapMarkerComponent*> outMarkers;
+    QueryMarkersInRadius(FVector2D(center), radius, categories, outMarkers);
+    return outMarkers;
+}
+
+void UAMSMapSubsystem::QueryMarkersInArea(const FBox2D& worldArea, const FGameplayTagContainer& categories, TArray<UAMSMapMarkerComponent*>& outMarkers) const
+{
+    outMarkers.Reset();
+    if (!MarkersTree) {
+        return;
+    }
+
+    MarkersTree->GetElements(worldArea, outMarkers);
+    if (!categories.IsEmpty()) {
+        outMarkers.RemoveAllSwap([&categories](const UAMSMapMarkerComponent* markerComp) {
+            return !categories.HasTagExact(markerComp->GetMarkerCategory());
+        });
+    }
+}
+
+void UAMSMapSubsystem::QueryMarkersInRadius(const FVector2D& center, float radius, const FGameplayTagContainer& categories, TArray<UAMSMapMarkerComponent*>& outMarkers) const
+{
+    QueryMarkersInArea(FBox2D(center - FVector2D(radius), center + FVector2D(radius)), categories, outMarkers);
+
+    const float radiusSquared = FMath::Square(radius);
+    outMarkers.RemoveAllSwap([&](UAMSMapMarkerComponent* markerComp) {
+        const int32* index = MarkerIndices.Find(markerComp);
+        return !index || FVector2D::DistSquared(MarkerPositions[*index], center) > radiusSquared;
+    });
+}
+
+FVector2D UAMSMapSubsystem::GetMarkerTreePosition(const UAMSMapMarkerComponent* markerComp)
+{
+    const float halfSize = AMSMapSubsystemConstants::TreeHalfSize;
+    const FVector ownerLoc = markerComp->GetOwnerLocation();
+    return FVector2D(FMath::Clamp<float>(ownerLoc.X, -halfSize, halfSize), FMath::Clamp<float>(ownerLoc.Y, -halfSize, halfSize));
+}
+
 AAMSActorMarker* UAMSMapSubsystem::SpawnMarkerActor(const TSubclassOf<AAMSActorMarker>& markerClass, const FVector& worldPos, bool bProjectToNavmesh)
 {
     FVector finalPos = worldPos;
@@ -79,14 +236,10 @@ bool UAMSMapSubsystem::HasAtLeastOneMarkerActor() const
 
 TArray<UAMSMapMarkerComponent*> UAMSMapSubsystem::GetAllMarkersByCategory(const FGameplayTag& categoryTag) const
 {
-    TArray<UAMSMapMarkerComponent*> outMarkers;
-
-    for ( UAMSMapMarkerComponent* markerComp : Markers) {
-        if (markerComp->GetMarkerCategory() == categoryTag) {
-            outMarkers.Add(markerComp);
-        }        
+    if (const TArray<TObjectPtr<UAMSMapMarkerComponent>>* categoryMarkers = MarkersByCategory.Find(categoryTag)) {
+        return TArray<UAMSMapMarkerComponent*>(*categoryMarkers);
     }
-    return outMarkers;
+    return TArray<UAMSMapMarkerComponent*>();
 }
 
 void UAMSMapSubsystem::RemoveAllMarkersByCategory(const FGameplayTag& categoryTag)
@@ -140,46 +293,92 @@ void UAMSMapSubsystem::SetCurrentMapArea(AAMSMapArea* mapActor)
     OnMapAreaChanged.Broadcast(mapActor);
 }
 
-TArray<AAMSMapLocation*> UAMSMapSubsystem::GetAllLocations() const
+void UAMSMapSubsystem::RegisterLocation(AAMSMapLocation* location)
 {
-    TArray<AActor*> outLocs;
-    TArray<AAMSMapLocation*> finalLocs;
-    UGameplayStatics::GetAllActorsOfClass(this, AAMSMapLocation::StaticClass(), outLocs);
+    if (!location || LocationIndices.Contains(location)) {
+        return;
+    }
 
-    for (const auto loc : outLocs) {
-        AAMSMapLocation* mapLoc = Cast<AAMSMapLocation>(loc);
-        if (mapLoc) {
-            finalLocs.Add(mapLoc);
-        }
+    const FName locationName = FName(*location->GetLocationName());
+    LocationIndices.Add(location, Locations.Add(location));
+    LocationNames.Add(locationName);
+    DiscoveredLocations.Add(location->IsDiscovered());
+    if (!LocationsByName.Contains(locationName)) {
+        LocationsByName.Add(locationName, location);
     }
-    return finalLocs;
 }
 
-AAMSMapLocation* UAMSMapSubsystem::GetLocationByName(const FName& locationName) const
+void UAMSMapSubsystem::UnregisterLocation(AAMSMapLocation* location)
 {
-    TArray<AActor*> outLocs;
-    UGameplayStatics::GetAllActorsOfClass(this, AAMSMapLocation::StaticClass(), outLocs);
+    int32 index;
+    if (!LocationIndices.RemoveAndCopyValue(location, index)) {
+        return;
+    }
 
-    for (const auto loc : outLocs) {
-        AAMSMapLocation* mapLoc = Cast<AAMSMapLocation>(loc);
-        if (mapLoc && mapLoc->GetLocationName() == locationName) {
-            return mapLoc;
-        }
+    const FName locationName = LocationNames[index];
+    Locations.RemoveAtSwap(index);
+    LocationNames.RemoveAtSwap(index);
+    DiscoveredLocations.RemoveAtSwap(index);
+    if (Locations.IsValidIndex(index)) {
+        LocationIndices.FindChecked(Locations[index]) = index;
+    }
+
+    if (LocationsByName.FindRef(locationName) == location) {
+        ReindexLocationName(locationName);
+    }
+}
+
+void UAMSMapSubsystem::ReindexLocationName(const FName& locationName)
+{
+    // only runs when the indexed location of a name leaves, so a scan of the loaded names is fine
+    const int32 index = LocationNames.IndexOfByKey(locationName);
+    if (index != INDEX_NONE) {
+        LocationsByName.Add(locationName, Locations[index]);
+    } else {
+        LocationsByName.Remove(locationName);
+    }
+}
+
+void UAMSMapSubsystem::NotifyLocationRenamed(AAMSMapLocation* location)
+{
+    const int32* index = LocationIndices.Find(location);
+    if (!index) {
+        return;
+    }
+
+    const FName oldName = LocationNames[*index];
+    const FName newName = FName(*location->GetLocationName());
+    LocationNames[*index] = newName;
+    if (LocationsByName.FindRef(oldName) == location) {
+        ReindexLocationName(oldName);
+    }
+    if (!LocationsByName.Contains(newName)) {
+        LocationsByName.Add(newName, location);
+    }
+}
+
+void UAMSMapSubsystem::NotifyLocationDiscoveredChanged(AAMSMapLocation* location)
+{
+    if (const int32* index = LocationIndices.Find(location)) {
+        DiscoveredLocations[*index] = location->IsDiscovered();
     }
-    return nullptr;
+}
+
+TArray<AAMSMapLocation*> UAMSMapSubsystem::GetAllLocations() const
+{
+    return Locations;
+}
+
+AAMSMapLocation* UAMSMapSubsystem::GetLocationByName(const FName& locationName) const
+{
+    return LocationsByName.FindRef(locationName);
 }
 
 TArray<AAMSMapLocation*> UAMSMapSubsystem::GetAllDiscoveredLocation() const
 {
-    TArray<AActor*> outLocs;
     TArray<AAMSMapLocation*> finalLocs;
-    UGameplayStatics::GetAllActorsOfClass(this, AAMSMapLocation::StaticClass(), outLocs);
-
-    for (const auto loc : outLocs) {
-        AAMSMapLocation* mapLoc = Cast<AAMSMapLocation>(loc);
-        if (mapLoc && mapLoc->IsDiscovered()) {
-            finalLocs.Add(mapLoc);
-        }
+    for (TConstSetBitIterator<> it(DiscoveredLocations); it; ++it) {
+        finalLocs.Add(Locations[it.GetIndex()]);
     }
     return finalLocs;
 }
@@ -187,13 +386,10 @@ TArray<AAMSMapLocation*> UAMSMapSubsystem::GetAllDiscoveredLocation() const
 
 TArray<AAMSMapLocation*> UAMSMapSubsystem::GetAllDiscoveredFastTravelLocation() const
 {
-    TArray<AActor*> outLocs;
     TArray<AAMSMapLocation*> finalLocs;
-    UGameplayStatics::GetAllActorsOfClass(this, AAMSMapLocation::StaticClass(), outLocs);
-
-    for (const auto loc : outLocs) {
-        AAMSMapLocation* mapLoc = Cast<AAMSMapLocation>(loc);
-        if (mapLoc && mapLoc->IsDiscovered() && mapLoc->CanFastTravel()) {
+    for (TConstSetBitIterator<> it(DiscoveredLocations); it; ++it) {
+        AAMSMapLocation* mapLoc = Locations[it.GetIndex()];
+        if (mapLoc->CanFastTravel()) {
             finalLocs.Add(mapLoc);
         }
     }
@@ -207,12 +403,10 @@ TArray<class UAMSMapMarkerComponent*> UAMSMapSubsystem::GetAllMarkers() const
 
 void UAMSMapSubsystem::DiscoverAllLocation()
 {
-    TArray<AActor*> outLocs;
-    UGameplayStatics::GetAllActorsOfClass(this, AAMSMapLocation::StaticClass(), outLocs);
-
-    for (const auto loc : outLocs) {
-        AAMSMapLocation* mapLoc = Cast<AAMSMapLocation>(loc);
-        if (mapLoc) {
+    /*Copy, discovering a location may end up registering or unregistering actors*/
+    const TArray<TObjectPtr<AAMSMapLocation>> locations = Locations;
+    for (AAMSMapLocation* mapLoc : locations) {
+        if (IsValid(mapLoc)) {
             mapLoc->SetDiscoveredState(true);
         }
     }
@@ -220,7 +414,7 @@ void UAMSMapSubsystem::DiscoverAllLocation()
 
 bool UAMSMapSubsystem::IsMarkerActive(const class UAMSMapMarkerComponent* markerComp) const
 {
-    return Markers.Contains(markerComp);
+    return MarkerIndices.Contains(const_cast<UAMSMapMarkerComponent*>(markerComp));
 }
 
 void UAMSMapSubsystem::UpdateCurrentMap()
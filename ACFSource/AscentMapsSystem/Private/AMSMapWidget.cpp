@@ -310,7 +310,11 @@ void UAMSMapWidget::Internal_SetCanvasPosition(const FVector2D& updatedPos)
     FVector2D finalPos = updatedPos;
     finalPos.Y = FMath::Clamp(updatedPos.Y, MinPos.Y, MaxPos.Y);
     finalPos.X = FMath::Clamp(updatedPos.X, MinPos.X, MaxPos.X);
-    CanvasSlot->SetPosition(finalPos);
+    if (finalPos != CanvasPos)
+    {
+        CanvasSlot->SetPosition(finalPos);
+        bPendingCullingUpdate = true;
+    }
 }
 
 void UAMSMapWidget::CenterOnLocalPlayer()
@@ -352,6 +356,13 @@ void UAMSMapWidget::NativeConstruct()
         mapSubsystem->OnMapMarkerAdded.AddDynamic(this, &UAMSMapWidget::HandleMarkerAdded);
         mapSubsystem->OnMapMarkerRemoved.AddDynamic(this, &UAMSMapWidget::HandleMarkerRemoved);
         mapSubsystem->OnTrackedMarkerChanged.AddDynamic(this, &UAMSMapWidget::HandleTrackedMarkerChanged);
+        markerMovedHandle = mapSubsystem->OnMapMarkerMovedNative.AddUObject(this, &UAMSMapWidget::HandleMarkerMoved);
+        mapSubsystem->RegisterMapViewer();
+    }
+
+    if (MarkersClass)
+    {
+        markersVisibility = MarkersClass->GetDefaultObject<UAMSMarkerWidget>()->GetVisibility();
     }
 
     UCommonInputSubsystem* commonInputSub = GetInputSubsystem();
@@ -375,8 +386,9 @@ void UAMSMapWidget::NativeConstruct()
     }
     
     SetCurrentZoomLevel(DefaultZoomLevel);
-    UpdateMarkers();
 
+    /*Markers may have been added or removed while the map was closed*/
+    bPendingMarkersSync = true;
     bPendingTrackUpdate = true;
 }
 
@@ -408,7 +420,11 @@ void UAMSMapWidget::NativeDestruct()
     {
         mapSubsystem->OnMapMarkerAdded.RemoveDynamic(this, &UAMSMapWidget::HandleMarkerAdded);
         mapSubsystem->OnMapMarkerRemoved.RemoveDynamic(this, &UAMSMapWidget::HandleMarkerRemoved);
+        mapSubsystem->OnTrackedMarkerChanged.RemoveDynamic(this, &UAMSMapWidget::HandleTrackedMarkerChanged);
+        mapSubsystem->OnMapMarkerMovedNative.Remove(markerMovedHandle);
+        mapSubsystem->UnregisterMapViewer();
     }
+    dirtyMarkers.Reset();
     UCommonInputSubsystem* commonInputSub = GetInputSubsystem();
     if (commonInputSub)
     {
@@ -434,6 +450,21 @@ void UAMSMapWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
         break;
     }
 
+    if (bPendingMarkersSync)
+    {
+        SyncMarkersWithSubsystem();
+    }
+
+    if (bPendingCullingUpdate)
+    {
+        RefreshVisibleMarkers();
+    }
+
+    if (dirtyMarkers.Num() > 0)
+    {
+        Internal_UpdateDirtyMarkers();
+    }
+
     if (bPendingMarkersUpdate)
     {
         Internal_UpdateMarkers();
@@ -453,7 +484,7 @@ void UAMSMapWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 FAMSMarker UAMSMapWidget::GetCurrentlytTrackedMarker() const
 {
     const UAMSMapMarkerComponent* markerComp = GetMapSubsystem()->GetCurrentlytTrackedMarker();
-    const FAMSMarker* markerRef = markerWidgets.FindByKey(markerComp);
+    const FAMSMarker* markerRef = FindMarker(markerComp);
     if (markerRef && markerRef->ValidCheck())
     {
         return *markerRef;
@@ -488,6 +519,7 @@ void UAMSMapWidget::SetCurrentZoomLevel(float val)
         const FVector2D newSize = InitialCanvasSize * FVector2D(CurrentZoomLevel, CurrentZoomLevel);
         CanvasSlot->SetSize(newSize);
         Internal_SetCanvasPosition(CanvasSlot->GetPosition());
+        bPendingCullingUpdate = true;
         UpdateMarkers();
     }
 }
@@ -496,35 +528,277 @@ void UAMSMapWidget::Internal_UpdateMarkers()
 {
     bPendingMarkersUpdate = false;
 
-    UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(this);
-    UAMSMapSubsystem* mapSubsystem = GameInstance->GetSubsystem<UAMSMapSubsystem>();
+    Internal_UpdateClusters(GetMapSize());
+    for (FAMSMarker& marker : markerWidgets)
+    {
+        if (!marker.bClustered)
+        {
+            UpdateMarker(marker);
+        }
+    }
+}
 
-    if (mapSubsystem)
+void UAMSMapWidget::Internal_UpdateDirtyMarkers()
+{
+    const AAMSMapArea* mapArea = GetMapArea();
+    const FVector2D mapSize = GetMapSize();
+    const FBox2D visibleRect = GetVisibleMapRect();
+    const bool bClustering = IsClusteringActive();
+
+    const TSet<TObjectPtr<UAMSMapMarkerComponent>> markersToUpdate = MoveTemp(dirtyMarkers);
+    dirtyMarkers.Reset();
+    for (UAMSMapMarkerComponent* markerComp : markersToUpdate)
+    {
+        const int32* index = markerIndices.Find(markerComp);
+        if (!index)
+        {
+            /*The marker may just have entered the visible rect*/
+            Internal_AddMarker(markerComp, mapArea, mapSize, visibleRect);
+            continue;
+        }
+
+        const int32 markerIndex = *index;
+        FVector2D normalizedPos;
+        if (!IsMarkerDisplayable(markerComp, mapArea, mapSize, visibleRect, normalizedPos))
+        {
+            Internal_RemoveMarkerAt(markerIndex);
+            continue;
+        }
+
+        FAMSMarker& marker = markerWidgets[markerIndex];
+        marker.normalizedPosition = normalizedPos;
+        marker.bHighlighted = highlightedMarkers.Contains(markerComp);
+        if (!bClustering)
+        {
+            UpdateMarker(marker);
+        }
+    }
+
+    if (bClustering)
+    {
+        UpdateMarkers();
+    }
+}
+
+void UAMSMapWidget::RefreshVisibleMarkers()
+{
+    bPendingCullingUpdate = false;
+
+    UAMSMapSubsystem* mapSubsystem = GetMapSubsystem();
+    const AAMSMapArea* mapArea = GetMapArea();
+    if (!mapSubsystem || !mapArea)
+    {
+        return;
+    }
+
+    const FVector2D mapSize = GetMapSize();
+    const FBox2D visibleRect = GetVisibleMapRect();
+    mapSubsystem->QueryMarkersInArea(GetVisibleWorldArea(mapArea, mapSize), CategoriesFilter, queryResult);
+    if (UAMSMapMarkerComponent* trackedMarker = mapSubsystem->GetCurrentlytTrackedMarker())
+    {
+        queryResult.Add(trackedMarker);
+    }
+
+    bool bChanged = false;
+    TSet<UAMSMapMarkerComponent*> visibleMarkers;
+    visibleMarkers.Append(queryResult);
+    for (int32 index = markerWidgets.Num() - 1; index >= 0; --index)
     {
-        const TArray<class UAMSMapMarkerComponent*> markers = mapSubsystem->GetAllMarkers();
-        for (const auto& marker : markers)
+        if (!visibleMarkers.Contains(markerWidgets[index].markerComp))
         {
-            if (markerWidgets.Contains(marker))
+            Internal_RemoveMarkerAt(index);
+            bChanged = true;
+        }
+    }
+
+    for (UAMSMapMarkerComponent* markerComp : queryResult)
+    {
+        bChanged |= Internal_AddMarker(markerComp, mapArea, mapSize, visibleRect);
+    }
+
+    if (bChanged && IsClusteringActive())
+    {
+        UpdateMarkers();
+    }
+}
+
+void UAMSMapWidget::Internal_UpdateClusters(const FVector2D& mapSize)
+{
+    ReleaseAllClusters();
+
+    TMap<FIntPoint, TArray<int32>> cells;
+    if (IsClusteringActive())
+    {
+        const UAMSMapMarkerComponent* trackedMarker = GetMapSubsystem()->GetCurrentlytTrackedMarker();
+        const float cellSize = FMath::Max(ClusterCellSize, 1.f);
+        for (int32 index = 0; index < markerWidgets.Num(); ++index)
+        {
+            const FAMSMarker& marker = markerWidgets[index];
+            /*Highlighted and tracked markers are always displayed on their own*/
+            if (marker.bHighlighted || marker.markerComp == trackedMarker)
             {
-                FAMSMarker* markerStruct = markerWidgets.FindByKey(marker);
-                UpdateMarker(*markerStruct);
-            } else
+                continue;
+            }
+            const FVector2D localPos = mapSize * marker.normalizedPosition;
+            cells.FindOrAdd(FIntPoint(FMath::FloorToInt(localPos.X / cellSize), FMath::FloorToInt(localPos.Y / cellSize))).Add(index);
+        }
+    }
+
+    TBitArray<> clustered(false, markerWidgets.Num());
+    for (const auto& cell : cells)
+    {
+        if (cell.Value.Num() < ClusterMinMarkers)
+        {
+            continue;
+        }
+
+        UAMSMarkerWidget* clusterWidget = nullptr;
+        if (clusterWidgetsPool.Num() > 0)
+        {
+            clusterWidget = clusterWidgetsPool.Pop();
+        } else
+        {
+            clusterWidget = CreateWidget<UAMSMarkerWidget>(this, ClusterMarkersClass);
+            if (!clusterWidget)
             {
-                AddMarker(marker);
+                break;
+            }
+            MapCanvas->AddChildToCanvas(clusterWidget);
+        }
+        clusterWidgets.Add(clusterWidget);
+
+        FVector2D center = FVector2D::ZeroVector;
+        for (const int32 index : cell.Value)
+        {
+            center += markerWidgets[index].normalizedPosition;
+            clustered[index] = true;
+        }
+        center = mapSize * center / cell.Value.Num();
+        clusterWidget->SetupCluster(cell.Value.Num());
+        clusterWidget->SetRenderTranslation(center - MarkersSize - FVector2D(MarkersSize.X / 2, 0.f));
+        clusterWidget->SetVisibility(markersVisibility);
+    }
+
+    for (int32 index = 0; index < markerWidgets.Num(); ++index)
+    {
+        FAMSMarker& marker = markerWidgets[index];
+        if (marker.bClustered != clustered[index])
+        {
+            marker.bClustered = clustered[index];
+            if (marker.markerWidget)
+            {
+                marker.markerWidget->SetVisibility(marker.bClustered ? ESlateVisibility::Collapsed : markersVisibility);
             }
         }
     }
 }
 
-void UAMSMapWidget::HandleMarkerAdded(UAMSMapMarkerComponent* marker)
+void UAMSMapWidget::ReleaseAllClusters()
+{
+    for (UAMSMarkerWidget* clusterWidget : clusterWidgets)
+    {
+        clusterWidget->SetVisibility(ESlateVisibility::Collapsed);
+        clusterWidgetsPool.Add(clusterWidget);
+    }
+    clusterWidgets.Reset();
+}
+
+bool UAMSMapWidget::IsClusteringActive() const
+{
+    return bClusterMarkers && ClusterMarkersClass && CurrentZoomLevel <= ClusterZoomThreshold;
+}
+
+bool UAMSMapWidget::IsMarkerDisplayable(const UAMSMapMarkerComponent* marker, const AAMSMapArea* mapArea, const FVector2D& mapSize, const FBox2D& visibleRect, FVector2D& outNormalizedPos) const
+{
+    if (!IsValid(marker) || !mapArea)
+    {
+        return false;
+    }
+
+    const FVector worldLoc = marker->GetOwnerLocation();
+    if (!mapArea->IsPointInThisArea(worldLoc))
+    {
+        return false;
+    }
+
+    outNormalizedPos = mapArea->GetNormalized2DPositionFromWorldLocation(worldLoc);
+    if (bCullMarkersOutsideView && !visibleRect.IsInside(mapSize * outNormalizedPos))
+    {
+        return false;
+    }
+
+    if (!CategoriesFilter.IsEmpty() && !CategoriesFilter.HasTagExact(marker->GetMarkerCategory()))
+    {
+        /*The tracked marker uses its own category and must never be filtered out*/
+        return marker == GetMapSubsystem()->GetCurrentlytTrackedMarker();
+    }
+    return true;
+}
+
+FBox2D UAMSMapWidget::GetVisibleMapRect() const
 {
+    /*The map brush is centered in the canvas, so its offset moves the visible center away from the map center*/
+    const FVector2D viewCenter = GetMapSize() * 0.5f - GetMapOffset();
+    const FVector2D halfExtent = CanvasSize * 0.5f + FVector2D(MarkersCullingMargin);
+    return FBox2D(viewCenter - halfExtent, viewCenter + halfExtent);
+}
+
+FBox2D UAMSMapWidget::GetVisibleWorldArea(const AAMSMapArea* mapArea, const FVector2D& mapSize) const
+{
+    const FBox2D visibleRect = bCullMarkersOutsideView ? GetVisibleMapRect() : FBox2D(FVector2D::ZeroVector, mapSize);
+    const FVector2D topLeft = mapArea->GetMapAreaTopLeftmostPoint();
+    const FVector2D worldSize = mapArea->GetMapAreaBottomRightmostPoint() - topLeft;
+    const FVector2D safeMapSize(FMath::Max(mapSize.X, 1.f), FMath::Max(mapSize.Y, 1.f));
+    return FBox2D(topLeft + visibleRect.Min / safeMapSize * worldSize, topLeft + visibleRect.Max / safeMapSize * worldSize);
+}
+
+void UAMSMapWidget::SyncMarkersWithSubsystem()
+{
+    bPendingMarkersSync = false;
+
+    /*Markers may have been added, removed or moved while the map was closed, so the visible ones are queried again*/
+    while (markerWidgets.Num() > 0)
+    {
+        Internal_RemoveMarkerAt(markerWidgets.Num() - 1);
+    }
+    markerIndices.Reset();
+    dirtyMarkers.Reset();
+    ReleaseAllClusters();
+
+    const UAMSMapSubsystem* mapSubsystem = GetMapSubsystem();
+    for (auto it = highlightedMarkers.CreateIterator(); it; ++it)
+    {
+        if (!mapSubsystem || !mapSubsystem->IsMarkerActive(*it))
+        {
+            it.RemoveCurrent();
+        }
+    }
+
+    bPendingCullingUpdate = true;
     UpdateMarkers();
 }
 
+void UAMSMapWidget::SetCategoriesFilter(const FGameplayTagContainer& inCategories)
+{
+    CategoriesFilter = inCategories;
+    bPendingMarkersSync = true;
+}
+
+void UAMSMapWidget::HandleMarkerAdded(UAMSMapMarkerComponent* marker)
+{
+    AddMarker(marker);
+}
+
 void UAMSMapWidget::HandleMarkerRemoved(UAMSMapMarkerComponent* marker)
 {
     RemoveMarker(marker);
-    UpdateMarkers();
+    dirtyMarkers.Remove(marker);
+    highlightedMarkers.Remove(marker);
+}
+
+void UAMSMapWidget::HandleMarkerMoved(UAMSMapMarkerComponent* marker)
+{
+    dirtyMarkers.Add(marker);
 }
 
 void UAMSMapWidget::Internal_HandleMarkerHovered(const UAMSMarkerWidget* marker)
@@ -591,83 +865,166 @@ void UAMSMapWidget::TrackMarker(const FAMSMarker& marker)
 void UAMSMapWidget::UntrackCurrentMarker()
 {
     UAMSMapMarkerComponent* markerComp = GetMapSubsystem()->GetCurrentlytTrackedMarker();
-    FAMSMarker* markerRef = markerWidgets.FindByKey(markerComp);
+    if (!markerComp)
+    {
+        return;
+    }
+
+    /*The tracked marker may be culled and have no widget*/
+    FAMSMarker* markerRef = FindMarker(markerComp);
     if (markerRef && markerRef->ValidCheck())
     {
         markerRef->markerWidget->TrackMarker(false);
-        GetMapSubsystem()->UntrackMarker();
     }
+    GetMapSubsystem()->UntrackMarker();
 }
 
 void UAMSMapWidget::AddMarker(UAMSMapMarkerComponent* marker)
 {
-    const FVector worldLoc = marker->GetOwnerLocation();
-    const AAMSMapArea* mapAreaBound = GetMapArea();
-    if (mapAreaBound && mapAreaBound->IsPointInThisArea(worldLoc))
+    Internal_AddMarker(marker, GetMapArea(), GetMapSize(), GetVisibleMapRect());
+}
+
+bool UAMSMapWidget::Internal_AddMarker(UAMSMapMarkerComponent* marker, const AAMSMapArea* mapArea, const FVector2D& mapSize, const FBox2D& visibleRect)
+{
+    FVector2D normalizedPos;
+    if (FindMarker(marker) || !IsMarkerDisplayable(marker, mapArea, mapSize, visibleRect, normalizedPos))
     {
-        UAMSMarkerWidget* widgetMarker = CreateWidget<UAMSMarkerWidget>(this, MarkersClass);
-        FAMSMarker markerStruct = FAMSMarker(marker, widgetMarker);
-        markerWidgets.Add(markerStruct);
-        widgetMarker->SetupMarkerIcon(marker);
-        widgetMarker->SetMarkerIcon(marker->GetMarkerTexture());
-        widgetMarker->OnHovered.AddDynamic(this, &UAMSMapWidget::Internal_HandleMarkerHovered);
-        widgetMarker->OnUnhovered.AddDynamic(this, &UAMSMapWidget::Internal_HandleMarkerUnhovered);
-        /*   widgetMarker->SetMarkerSize(MarkersSize);*/
-        MapCanvas->AddChildToCanvas(widgetMarker);
-        UpdateMarker(markerStruct);
+        return false;
+    }
+
+    UAMSMarkerWidget* widgetMarker = AcquireMarkerWidget();
+    if (!widgetMarker)
+    {
+        return false;
+    }
+
+    FAMSMarker markerStruct = FAMSMarker(marker, widgetMarker);
+    markerStruct.normalizedPosition = normalizedPos;
+    markerStruct.bHighlighted = highlightedMarkers.Contains(marker);
+    widgetMarker->SetupMarkerIcon(marker);
+    widgetMarker->SetMarkerIcon(marker->GetMarkerTexture());
+    /*   widgetMarker->SetMarkerSize(MarkersSize);*/
+    if (marker == GetMapSubsystem()->GetCurrentlytTrackedMarker())
+    {
+        widgetMarker->TrackMarker(true);
     }
+
+    const int32 index = markerWidgets.Add(markerStruct);
+    markerIndices.Add(marker, index);
+    if (IsClusteringActive())
+    {
+        UpdateMarkers();
+    } else
+    {
+        UpdateMarker(markerWidgets[index]);
+    }
+    return true;
 }
 
 void UAMSMapWidget::RemoveMarker(class UAMSMapMarkerComponent* marker)
 {
-    if (markerWidgets.Contains(marker))
+    const int32* index = markerIndices.Find(marker);
+    if (index)
     {
-        const int32 index = markerWidgets.IndexOfByKey(marker);
-        if (markerWidgets.IsValidIndex(index))
+        Internal_RemoveMarkerAt(*index);
+    }
+}
+
+void UAMSMapWidget::Internal_RemoveMarkerAt(int32 index)
+{
+    const FAMSMarker markerStruct = markerWidgets[index];
+    markerIndices.Remove(markerStruct.markerComp);
+    markerWidgets.RemoveAtSwap(index);
+    if (markerWidgets.IsValidIndex(index))
+    {
+        if (int32* movedIndex = markerIndices.Find(markerWidgets[index].markerComp))
         {
-            FAMSMarker markerStruct = markerWidgets[index];
-            markerWidgets.Remove(markerStruct);
-            if (markerStruct.markerWidget)
-            {
-                markerStruct.markerWidget->RemoveFromParent();
-                markerStruct.markerWidget->OnHovered.RemoveDynamic(this, &UAMSMapWidget::Internal_HandleMarkerHovered);
-                markerStruct.markerWidget->OnUnhovered.RemoveDynamic(this, &UAMSMapWidget::Internal_HandleMarkerUnhovered);
-            }
+            *movedIndex = index;
+        }
+    }
+
+    if (HoveredWidget == markerStruct.markerWidget)
+    {
+        HoveredWidget.Reset();
+    }
+    ReleaseMarkerWidget(markerStruct.markerWidget);
+
+    if (IsClusteringActive())
+    {
+        UpdateMarkers();
+    }
+}
+
+UAMSMarkerWidget* UAMSMapWidget::AcquireMarkerWidget()
+{
+    if (markerWidgetsPool.Num() > 0)
+    {
+        UAMSMarkerWidget* widgetMarker = markerWidgetsPool.Pop();
+        if (widgetMarker->IsTracked())
+        {
+            widgetMarker->TrackMarker(false);
         }
+        widgetMarker->SetVisibility(markersVisibility);
+        return widgetMarker;
+    }
+
+    UAMSMarkerWidget* widgetMarker = CreateWidget<UAMSMarkerWidget>(this, MarkersClass);
+    if (widgetMarker)
+    {
+        widgetMarker->OnHovered.AddDynamic(this, &UAMSMapWidget::Internal_HandleMarkerHovered);
+        widgetMarker->OnUnhovered.AddDynamic(this, &UAMSMapWidget::Internal_HandleMarkerUnhovered);
+        MapCanvas->AddChildToCanvas(widgetMarker);
+    }
+    return widgetMarker;
+}
+
+void UAMSMapWidget::ReleaseMarkerWidget(UAMSMarkerWidget* widgetMarker)
+{
+    /*Widgets stay in the canvas collapsed, so recycling them does not rebuild any slot*/
+    if (widgetMarker)
+    {
+        widgetMarker->SetVisibility(ESlateVisibility::Collapsed);
+        markerWidgetsPool.Add(widgetMarker);
     }
 }
 
+FAMSMarker* UAMSMapWidget::FindMarker(const UAMSMapMarkerComponent* marker)
+{
+    const int32* index = markerIndices.Find(const_cast<UAMSMapMarkerComponent*>(marker));
+    return index ? &markerWidgets[*index] : nullptr;
+}
+
+const FAMSMarker* UAMSMapWidget::FindMarker(const UAMSMapMarkerComponent* marker) const
+{
+    const int32* index = markerIndices.Find(const_cast<UAMSMapMarkerComponent*>(marker));
+    return index ? &markerWidgets[*index] : nullptr;
+}
+
 void UAMSMapWidget::HighlightMarker(class UAMSMapMarkerComponent* marker, bool resetOtherMarkers /*= true*/)
 {
     if (resetOtherMarkers)
     {
         RemoveAllMarkerHighlights();
     }
-    FAMSMarker* markerWidget = markerWidgets.FindByKey(marker);
-    if (markerWidget)
+    if (marker)
     {
-        markerWidget->bHighlighted = true;
+        highlightedMarkers.Add(marker);
+        dirtyMarkers.Add(marker);
     }
-    UpdateMarkers();
 }
 
 void UAMSMapWidget::RemoveAllMarkerHighlights()
 {
-    for (const auto& marker : markerWidgets)
-    {
-        RemoveMarkerHighlight(marker.markerComp);
-    }
-    UpdateMarkers();
+    dirtyMarkers.Append(highlightedMarkers);
+    highlightedMarkers.Reset();
 }
 
 void UAMSMapWidget::RemoveMarkerHighlight(class UAMSMapMarkerComponent* marker)
 {
-    FAMSMarker* markerWidget = markerWidgets.FindByKey(marker);
-    if (markerWidget)
+    if (highlightedMarkers.Remove(marker) > 0)
     {
-        markerWidget->bHighlighted = false;
+        dirtyMarkers.Add(marker);
     }
-    UpdateMarkers();
 }
 
 void UAMSMapWidget::UpdateMarkers()
@@ -677,13 +1034,10 @@ void UAMSMapWidget::UpdateMarkers()
 
 void UAMSMapWidget::UpdateMarker(FAMSMarker& marker)
 {
-    AAMSMapArea* mapArea = GetMapArea();
-
-    if (mapArea && marker.markerComp && marker.markerWidget)
+    if (marker.markerComp && marker.markerWidget)
     {
-        const FVector2D mapPos = mapArea->GetNormalized2DPositionFromWorldLocation(marker.markerComp->GetOwnerLocation());
         const FVector2D mapSize = GetMapSize();
-        const FVector2D scaledPos = (mapSize * mapPos) - (MarkersSize) - FVector2D(MarkersSize.X / 2, 0.f);
+        const FVector2D scaledPos = (mapSize * marker.normalizedPosition) - (MarkersSize) - FVector2D(MarkersSize.X / 2, 0.f);
         marker.markerWidget->SetRenderTranslation(scaledPos);
         if (marker.bHighlighted)
         {
@@ -726,6 +1080,7 @@ UCommonInputSubsystem* UAMSMapWidget::GetInputSubsystem() const
 void UAMSMapWidget::SetMapArea(const FName& mapArea)
 {
     AreaTag = mapArea;
+    bPendingMarkersSync = true;
     const AAMSMapArea* mapAreaBound = GetMapArea();
 
     if (mapAreaBound)
@@ -68,6 +68,7 @@ public:
 protected:
     // Called when the game starts or when spawned
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     UPROPERTY(VisibleAnywhere, DisplayName = "Discover Area Component", Category = "AMS")
     TObjectPtr<USphereComponent> SphereComp;
 
@@ -102,6 +103,8 @@ private:
     UPROPERTY(Savegame)
     bool bDiscovered = false;
 
+    class UAMSMapSubsystem* GetMapSubsystem() const;
+
     UFUNCTION()
     void HandleLocalPlayerOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 };
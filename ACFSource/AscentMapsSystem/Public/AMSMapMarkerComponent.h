@@ -11,6 +11,14 @@
 
 class UAMSMarkerWidget;
 
+UENUM(BlueprintType)
+enum class EAMSMarkerUpdateMode : uint8 {
+    /*The position is sent to the map once when the marker is added, the component never ticks for it*/
+    EStatic = 0 UMETA(DisplayName = "Static"),
+    /*The position is sent to the map periodically, only when the owner moved enough*/
+    EDynamic = 1 UMETA(DisplayName = "Dynamic"),
+};
+
 UCLASS(ClassGroup = (ANS), meta = (BlueprintSpawnableComponent))
 class ASCENTMAPSSYSTEM_API UAMSMapMarkerComponent : public UWidgetComponent {
     GENERATED_BODY()
@@ -23,6 +31,7 @@ protected:
     // Called when the game starts
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
     /*Texture to be used to render this marker*/
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = AMS)
@@ -44,6 +53,27 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = AMS)
     bool bActivateWorldWidget = true;
 
+    /*Static markers never tick to update their position, use it for anything that doesn't move*/
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AMS|Update")
+    EAMSMarkerUpdateMode MarkerUpdateMode = EAMSMarkerUpdateMode::EDynamic;
+
+    /*Seconds between two position checks of a dynamic marker*/
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AMS|Update", meta = (ClampMin = 0.f, EditCondition = "MarkerUpdateMode == EAMSMarkerUpdateMode::EDynamic"))
+    float PositionUpdateInterval = 0.2f;
+
+    /*Minimum distance the owner must move before a dynamic marker sends its new position*/
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AMS|Update", meta = (ClampMin = 0.f, EditCondition = "MarkerUpdateMode == EAMSMarkerUpdateMode::EDynamic"))
+    float PositionUpdateThreshold = 100.f;
+
+    /*If false, while no map is open dynamic markers only send their position every ClosedMapPositionUpdateInterval,
+    so the map subsystem area queries stay roughly valid. Enable it if gameplay code needs precise positions at any time*/
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AMS|Update", meta = (EditCondition = "MarkerUpdateMode == EAMSMarkerUpdateMode::EDynamic"))
+    bool bUpdateWhenMapClosed = false;
+
+    /*Seconds between two position checks of a dynamic marker while no map is open*/
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AMS|Update", meta = (ClampMin = 0.f, EditCondition = "MarkerUpdateMode == EAMSMarkerUpdateMode::EDynamic && !bUpdateWhenMapClosed"))
+    float ClosedMapPositionUpdateInterval = 2.f;
+
     UFUNCTION(BlueprintPure, Category = AMS)
     UAMSMarkerWidget* GetIconWidget() const
     {
@@ -85,16 +115,10 @@ public:
     }
 
     UFUNCTION(BlueprintCallable, Category = AMS)
-    void SetMarkerCategory(FGameplayTag val)
-    {
-        MarkerCategory = val;
-    }
+    void SetMarkerCategory(FGameplayTag val);
 
     UFUNCTION(BlueprintCallable, Category = AMS)
-    void RestoreMarkerCatgory()
-    {
-        MarkerCategory = originalCategory;
-    }
+    void RestoreMarkerCatgory();
 
     UFUNCTION(BlueprintCallable, Blueprintpure, Category = AMS)
     FRotator GetOwnerRotation() const;
@@ -109,10 +133,38 @@ public:
     bool GetActivateWorldWidget() const { return bActivateWorldWidget; }
 
     UFUNCTION(BlueprintCallable, Category = AMS)
-    void SetActivateWorldWidget(bool val) { bActivateWorldWidget = val; }
+    void SetActivateWorldWidget(bool val);
+
+    UFUNCTION(BlueprintPure, Category = AMS)
+    EAMSMarkerUpdateMode GetMarkerUpdateMode() const { return MarkerUpdateMode; }
+
+    UFUNCTION(BlueprintCallable, Category = AMS)
+    void SetMarkerUpdateMode(EAMSMarkerUpdateMode val);
+
+    /*Immediately sends the owner position to the map, useful to move static markers*/
+    UFUNCTION(BlueprintCallable, Category = AMS)
+    void UpdateMarkerPosition();
+
+    /*Enables the tick only if the world widget is displayed or the position must be synced*/
+    void UpdateTickState();
 
 private:
     TObjectPtr<UAMSMarkerWidget> iconWidget;
 
+    TWeakObjectPtr<class UAMSMapSubsystem> cachedMapSubsystem;
+
+    class UAMSMapSubsystem* GetMapSubsystem() const;
+
+    void SyncPosition(bool bForce);
+
+    FVector lastSyncedLocation;
+    float lastSyncedYaw = 0.f;
+    float positionSyncTimer = 0.f;
+    float positionSyncInterval = 0.f;
+
+    bool bWorldWidgetTick = false;
+    bool bPositionSyncTick = false;
+    bool bLowRatePositionSync = false;
+
     FGameplayTag originalCategory;
 };
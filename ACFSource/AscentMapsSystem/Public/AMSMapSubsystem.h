@@ -5,6 +5,7 @@
 #include "AMSTypes.h"
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "GenericQuadTree.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 
 #include "AMSMapSubsystem.generated.h"
@@ -26,6 +27,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTrackedMarkerChanged, UAMSMapMark
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMapAreaChanged, AAMSMapArea*, mapArea);
 
+/*Native only: fired every time a registered marker moves, too frequent for blueprints*/
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMapMarkerMovedNative, UAMSMapMarkerComponent*);
+
 UCLASS()
 class ASCENTMAPSSYSTEM_API UAMSMapSubsystem : public UGameInstanceSubsystem {
     GENERATED_BODY()
@@ -33,6 +37,9 @@ class ASCENTMAPSSYSTEM_API UAMSMapSubsystem : public UGameInstanceSubsystem {
 public:
 
     UAMSMapSubsystem();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
     /*MAP AREAS*/
     void RegisterMapArea(const FName& tag, TObjectPtr<class AAMSMapArea> map);
 
@@ -59,6 +66,15 @@ public:
     }
 
     /*LOCATIONS*/
+    void RegisterLocation(AAMSMapLocation* location);
+
+    void UnregisterLocation(AAMSMapLocation* location);
+
+    /*Called by registered locations to keep the name index and the discovered set updated*/
+    void NotifyLocationRenamed(AAMSMapLocation* location);
+
+    void NotifyLocationDiscoveredChanged(AAMSMapLocation* location);
+
     /*Returns all the locations in current map*/
     UFUNCTION(BlueprintPure, Category = AMS)
     TArray<AAMSMapLocation*> GetAllLocations() const;
@@ -91,6 +107,34 @@ public:
     UFUNCTION(BlueprintCallable, Category = AMS)
     void RemoveMarker(class UAMSMapMarkerComponent* markerComp);
 
+    /*Called by registered markers when their owner moves, forwarded to OnMapMarkerMovedNative*/
+    void NotifyMarkerMoved(class UAMSMapMarkerComponent* markerComp);
+
+    /*Map widgets call these when opened and closed, dynamic markers only sync their position while a map is open*/
+    void RegisterMapViewer();
+
+    void UnregisterMapViewer();
+
+    UFUNCTION(BlueprintPure, Category = AMS)
+    bool IsAnyMapOpen() const { return MapViewers > 0; }
+
+    /*Called by registered markers when their category changes, to keep the category index updated*/
+    void NotifyMarkerCategoryChanged(class UAMSMapMarkerComponent* markerComp, const FGameplayTag& oldCategory);
+
+    /*Returns the markers whose owner lies inside the provided world XY rect.
+    If categories is empty every category is returned*/
+    UFUNCTION(BlueprintCallable, Category = AMS)
+    TArray<UAMSMapMarkerComponent*> GetMarkersInArea(const FVector2D& areaMin, const FVector2D& areaMax, const FGameplayTagContainer& categories) const;
+
+    /*Returns the markers whose owner lies within radius (on the XY plane) from center.
+    If categories is empty every category is returned*/
+    UFUNCTION(BlueprintCallable, Category = AMS)
+    TArray<UAMSMapMarkerComponent*> GetMarkersInRadius(const FVector& center, float radius, const FGameplayTagContainer& categories) const;
+
+    void QueryMarkersInArea(const FBox2D& worldArea, const FGameplayTagContainer& categories, TArray<UAMSMapMarkerComponent*>& outMarkers) const;
+
+    void QueryMarkersInRadius(const FVector2D& center, float radius, const FGameplayTagContainer& categories, TArray<UAMSMapMarkerComponent*>& outMarkers) const;
+
     UFUNCTION(BlueprintCallable, Category = AMS)
     AAMSActorMarker* SpawnMarkerActor(const TSubclassOf<AAMSActorMarker>& markerClass, const FVector& worldPos, bool bProjectToNavmesh = true);
 
@@ -121,6 +165,8 @@ public:
     UPROPERTY(BlueprintAssignable, Category = AMS)
     FOnMapAreaChanged OnMapAreaChanged;
 
+    FOnMapMarkerMovedNative OnMapMarkerMovedNative;
+
     UFUNCTION(BlueprintPure, Category = AMS)
     bool HasAnyTrackedMarker() const;
 
@@ -145,10 +191,43 @@ private:
 
     TArray<TObjectPtr<UAMSMapMarkerComponent>> Markers;
 
+    /*Index of each registered marker inside Markers*/
+    TMap<TObjectPtr<UAMSMapMarkerComponent>, int32> MarkerIndices;
+
+    /*XY position each marker was inserted with in MarkersTree, same order as Markers*/
+    TArray<FVector2D> MarkerPositions;
+
+    TMap<FGameplayTag, TArray<TObjectPtr<UAMSMapMarkerComponent>>> MarkersByCategory;
+
+    /*Spatial index of the registered markers, updated as they move*/
+    TUniquePtr<TQuadTree<UAMSMapMarkerComponent*, 16>> MarkersTree;
+
+    static FVector2D GetMarkerTreePosition(const UAMSMapMarkerComponent* markerComp);
+
+    int32 MapViewers = 0;
+
+    void UpdateDynamicMarkersTickState();
+
     TObjectPtr<UAMSMapMarkerComponent> TrackedMarker;
     bool bHasMarkerTracked;
 
     TArray<TObjectPtr<AAMSActorMarker>> MarkerActors;
 
+    /*Locations currently loaded, registered in their BeginPlay and removed in their EndPlay*/
+    TArray<TObjectPtr<AAMSMapLocation>> Locations;
+
+    /*Name each location was indexed with, same order as Locations*/
+    TArray<FName> LocationNames;
+
+    TMap<TObjectPtr<AAMSMapLocation>, int32> LocationIndices;
+
+    /*First loaded location of each name, another one with the same name takes over when it leaves*/
+    TMap<FName, TObjectPtr<AAMSMapLocation>> LocationsByName;
+
+    void ReindexLocationName(const FName& locationName);
+
+    /*One bit per entry of Locations, set if discovered*/
+    TBitArray<> DiscoveredLocations;
+
     void UpdateCurrentMap();
 };
@@ -20,6 +20,7 @@
 
 class UAMSMarkerWidget;
 class UAMSMapSubsystem;
+class AAMSMapArea;
 class UCommonInputSubsystem;
 class UTexture2D;
 
@@ -160,6 +161,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = AMS)
     void RemoveMarkerHighlight(class UAMSMapMarkerComponent* marker);
 
+    /*Sets the categories of markers displayed in this map, empty means all*/
+    UFUNCTION(BlueprintCallable, Category = AMS)
+    void SetCategoriesFilter(const FGameplayTagContainer& inCategories);
+
+    UFUNCTION(BlueprintPure, Category = AMS)
+    FGameplayTagContainer GetCategoriesFilter() const { return CategoriesFilter; }
+
 protected:
     UPROPERTY(BlueprintReadWrite, meta = (BindWidget), Category = AMS)
     UBorder* MapBrush;
@@ -191,6 +199,38 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AMS|Markers")
     FVector2D MarkerScaleWhenHighlighted;
 
+    /*If true, only markers inside the visible portion of the map get a widget*/
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AMS|Markers")
+    bool bCullMarkersOutsideView = true;
+
+    /*Extra pixels around the visible map rect in which markers are still displayed*/
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AMS|Markers", meta = (EditCondition = "bCullMarkersOutsideView"))
+    float MarkersCullingMargin = 128.f;
+
+    /*Categories of markers displayed in this map, empty means all*/
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AMS|Markers")
+    FGameplayTagContainer CategoriesFilter;
+
+    /*If true, at low zoom levels markers closer than ClusterCellSize are grouped in a single widget*/
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AMS|Clustering")
+    bool bClusterMarkers = true;
+
+    /*Widget used to represent a group of markers, clustering is disabled if not set*/
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AMS|Clustering", meta = (EditCondition = "bClusterMarkers"))
+    TSubclassOf<UAMSMarkerWidget> ClusterMarkersClass;
+
+    /*Markers are clustered when the zoom level is lower or equal than this*/
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AMS|Clustering", meta = (EditCondition = "bClusterMarkers"))
+    float ClusterZoomThreshold = 0.5f;
+
+    /*Size in pixels of the grid cells used to group markers*/
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AMS|Clustering", meta = (EditCondition = "bClusterMarkers"))
+    float ClusterCellSize = 64.f;
+
+    /*Minimum amount of markers in the same cell to create a cluster*/
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AMS|Clustering", meta = (EditCondition = "bClusterMarkers"))
+    int32 ClusterMinMarkers = 3;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AMS|Actor Marker")
     FKey SpawnActorMarkerKey;
 
@@ -284,25 +324,78 @@ private:
     UFUNCTION()
     void HandleMarkerRemoved(class UAMSMapMarkerComponent* marker);
 
+    void HandleMarkerMoved(class UAMSMapMarkerComponent* marker);
+
     UFUNCTION()
     void Internal_HandleMarkerHovered(const UAMSMarkerWidget* marker);
 
     UFUNCTION()
     void Internal_HandleMarkerUnhovered(const UAMSMarkerWidget* marker);
 
+    UPROPERTY(Transient)
     TArray<FAMSMarker> markerWidgets;
 
+    /*Index of each marker component inside markerWidgets*/
+    TMap<TObjectPtr<UAMSMapMarkerComponent>, int32> markerIndices;
+
+    /*Marker widgets released by removed markers, kept collapsed in the canvas to be recycled*/
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UAMSMarkerWidget>> markerWidgetsPool;
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UAMSMarkerWidget>> clusterWidgets;
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UAMSMarkerWidget>> clusterWidgetsPool;
+
+    /*Markers that moved since last layout*/
+    TSet<TObjectPtr<UAMSMapMarkerComponent>> dirtyMarkers;
+
+    /*Highlighted markers, kept even when their widget is culled*/
+    TSet<TObjectPtr<UAMSMapMarkerComponent>> highlightedMarkers;
+
+    TArray<UAMSMapMarkerComponent*> queryResult;
+
     FAMSMarker HoveredWidget;
 
+    FDelegateHandle markerMovedHandle;
+
     void UpdateMarkers();
 
     void UpdateMarker(FAMSMarker& marker);
     void InitCanvas();
 
+    FAMSMarker* FindMarker(const UAMSMapMarkerComponent* marker);
+    const FAMSMarker* FindMarker(const UAMSMapMarkerComponent* marker) const;
+
+    UAMSMarkerWidget* AcquireMarkerWidget();
+    void ReleaseMarkerWidget(UAMSMarkerWidget* widgetMarker);
+    void ReleaseAllClusters();
+
+    void SyncMarkersWithSubsystem();
+    void RefreshVisibleMarkers();
+    void Internal_UpdateDirtyMarkers();
+    void Internal_UpdateClusters(const FVector2D& mapSize);
+    bool Internal_AddMarker(UAMSMapMarkerComponent* marker, const AAMSMapArea* mapArea, const FVector2D& mapSize, const FBox2D& visibleRect);
+    void Internal_RemoveMarkerAt(int32 index);
+    bool IsMarkerDisplayable(const UAMSMapMarkerComponent* marker, const AAMSMapArea* mapArea, const FVector2D& mapSize, const FBox2D& visibleRect, FVector2D& outNormalizedPos) const;
+    bool IsClusteringActive() const;
+    FBox2D GetVisibleMapRect() const;
+    FBox2D GetVisibleWorldArea(const AAMSMapArea* mapArea, const FVector2D& mapSize) const;
+
     float CurrentZoomLevel = 1.f;
 
+    /*Every marker must be laid out again (zoom, area change)*/
     bool bPendingMarkersUpdate = false;
 
+    /*The visible rect changed, the displayed markers must be queried again*/
+    bool bPendingCullingUpdate = false;
+
+    /*The marker list must be synced with the subsystem*/
+    bool bPendingMarkersSync = false;
+
+    ESlateVisibility markersVisibility = ESlateVisibility::Visible;
+
     EZoomState currentZoomState;
 
     // INITIAL VALUES//
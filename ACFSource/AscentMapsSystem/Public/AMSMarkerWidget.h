@@ -25,6 +25,10 @@ public:
     UFUNCTION(BlueprintImplementableEvent, Category = AMS)
     void SetupMarkerIcon(UAMSMapMarkerComponent* markerComp);
 
+    /*Called when this widget is used to represent a group of markers too close to be displayed separately*/
+    UFUNCTION(BlueprintImplementableEvent, Category = AMS)
+    void SetupCluster(int32 markersCount);
+
     UPROPERTY(BlueprintAssignable, Category = AMS)
     FOnHovered OnHovered;
 
@@ -44,6 +44,8 @@ public:
         markerComp = nullptr;
         markerWidget = nullptr;
         bHighlighted = false;
+        normalizedPosition = FVector2D::ZeroVector;
+        bClustered = false;
     };
 
     FAMSMarker(class UAMSMapMarkerComponent* inComp, class UAMSMarkerWidget* inWidget)
@@ -51,6 +53,8 @@ public:
         markerComp = inComp;
         markerWidget = inWidget;
         bHighlighted = false;
+        normalizedPosition = FVector2D::ZeroVector;
+        bClustered = false;
     }
 
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ACF)
@@ -62,6 +66,12 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ACF)
     bool bHighlighted;
 
+    /*Cached position of the marker in the map area, updated only when the marker moves*/
+    FVector2D normalizedPosition;
+
+    /*The widget is collapsed because the marker is represented by a cluster*/
+    bool bClustered;
+
     void Reset()
     {
         markerComp = nullptr;
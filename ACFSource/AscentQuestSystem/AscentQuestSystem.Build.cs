@@ -22,7 +22,8 @@ public class AscentQuestSystem : ModuleRules {
             new string[] {
                 "Core",
                 "AGSGraphRuntime",
-                "GameplayTags"
+                "GameplayTags",
+                "NetCore"
                 // ... add other public dependencies that you statically link with here ...
             });
 
@@ -1,12 +1,15 @@
 // Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
 
 #include "AQSQuestManagerComponent.h"
+#include "AQSQuestSubsystem.h"
 #include "AQSQuestTargetComponent.h"
 #include "AQSTypes.h"
 #include "Engine/DataTable.h"
+#include "Engine/GameInstance.h"
 #include "GameplayTagContainer.h"
 #include "Graph/AQSQuest.h"
 #include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
 #include <Containers/Map.h>
 #include <Kismet/GameplayStatics.h>
 
@@ -17,8 +20,7 @@ UAQSQuestManagerComponent::UAQSQuestManagerComponent()
     // off to improve performance if you don't need them.
     PrimaryComponentTick.bCanEverTick = false;
     SetIsReplicatedByDefault(true);
-
-    // ...
+    InProgressQuestsProgress.SetOwner(this);
 }
 
 void UAQSQuestManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -26,13 +28,18 @@ void UAQSQuestManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimePrope
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
     DOREPLIFETIME(UAQSQuestManagerComponent, CompletedQuestsTags);
     DOREPLIFETIME(UAQSQuestManagerComponent, FailedQuestsTags);
-    DOREPLIFETIME(UAQSQuestManagerComponent, InProgressQuestsRecords);
+    DOREPLIFETIME(UAQSQuestManagerComponent, InProgressQuestsProgress);
     DOREPLIFETIME(UAQSQuestManagerComponent, TrackedQuestTag);
 }
 // Called when the game starts
 void UAQSQuestManagerComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    UAQSQuestSubsystem* questSubsystem = GetQuestSubsystem();
+    if (questSubsystem) {
+        questSubsystem->IndexQuestsDB(QuestsDB);
+    }
 }
 
 void UAQSQuestManagerComponent::OnComponentSaved_Implementation()
@@ -124,7 +131,8 @@ bool UAQSQuestManagerComponent::StopQuest(const FGameplayTag& questTag)
         if (TrackedQuestTag == questTag) {
             UntrackCurrentQuest();
         }
-        InProgressQuestsRecords.Remove(FAQSQuestRecord(questToStop));
+        RemoveInProgressRecord(questTag);
+        UnregisterQuestListeners(questToStop);
 
         questToStop->OnQuestEnded.RemoveDynamic(this, &UAQSQuestManagerComponent::HandleQuestCompleted);
 
@@ -156,7 +164,7 @@ bool UAQSQuestManagerComponent::Internal_StartQuest(UAQSQuest* questToStart, con
     ensure(playerController);
     if (questToStart && questToStart->StartQuest(playerController, this, bStartChildNodes)) {
         InProgressQuests.Add(questToStart);
-        InProgressQuestsRecords.AddUnique(FAQSQuestRecord(questToStart));
+        AddInProgressRecord(FAQSQuestRecord(questToStart));
 
         if (!questToStart->OnQuestEnded.IsAlreadyBound(this, &UAQSQuestManagerComponent::HandleQuestCompleted)) {
             questToStart->OnQuestEnded.AddDynamic(this, &UAQSQuestManagerComponent::HandleQuestCompleted);
@@ -184,11 +192,10 @@ bool UAQSQuestManagerComponent::Internal_StartQuest(UAQSQuest* questToStart, con
 
 bool UAQSQuestManagerComponent::CompleteObjective(FGameplayTag objectiveToComplete)
 {
-    for (UAQSQuest* quest : InProgressQuests) {
-        if (quest->HasActiveObjective(objectiveToComplete)) {
-            const bool bCompleted = quest->CompleteObjective(objectiveToComplete);
-            return bCompleted;
-        }
+    const TArray<UAQSQuest*>* listeners = objectiveListeners.Find(objectiveToComplete);
+    if (listeners && listeners->Num() > 0) {
+        UAQSQuest* quest = (*listeners)[0];
+        return quest->CompleteObjective(objectiveToComplete);
     }
     return false;
 }
@@ -223,54 +230,137 @@ TArray<AActor*> UAQSQuestManagerComponent::GetCurrentlyTrackedQuestObjectivesTar
     return targets;
 }
 
-bool UAQSQuestManagerComponent::IsObjectiveInProgress(const FGameplayTag& objectiveTag) const
-{
-    for (const auto& quest : InProgressQuestsRecords) {
-        if (DoesQuestHaveInProgressObjective(quest, objectiveTag)) {
-            return true;
-        }
-    }
-    return false;
-}
-
 class UAQSQuest* UAQSQuestManagerComponent::GetQuestFromDB(const FGameplayTag& questTag)
 {
     UAQSQuest* newQuest = GetQuest(questTag);
     if (newQuest) {
         return newQuest;
     }
-    if (!QuestsDB) {
-        UE_LOG(LogTemp, Error, TEXT("Missing Quests Database from Quest Manager! - UAQSQuestManagerComponent::GetQuestFromDB"));
+
+    const UAQSQuest* questTemplate = GetQuestTemplate(questTag);
+    if (questTemplate) {
+        newQuest = DuplicateObject(questTemplate, GetOuter());
+        loadedQuests.Add(questTag, newQuest);
+        return newQuest;
+    }
+    return nullptr;
+}
+
+class UAQSQuest* UAQSQuestManagerComponent::GetQuest(const FGameplayTag& questTag)
+{
+    UAQSQuest* quest = FindLoadedQuest(questTag);
+    if (quest) {
+        return quest;
+    }
+    return InstanceEndedQuest(questTag);
+}
+
+UAQSQuest* UAQSQuestManagerComponent::FindLoadedQuest(const FGameplayTag& questTag) const
+{
+    UAQSQuest* const* quest = loadedQuests.Find(questTag);
+    return quest ? *quest : nullptr;
+}
+
+UAQSQuest* UAQSQuestManagerComponent::InstanceEndedQuest(const FGameplayTag& questTag)
+{
+    if (!IsQuestCompletedByTag(questTag) && !IsQuestFailedByTag(questTag)) {
         return nullptr;
     }
 
-    for (const auto it : QuestsDB->GetRowMap()) {
-        FAQSQuestData* questStruct = (FAQSQuestData*)(it.Value);
-        if (!questStruct) {
-            break;
-        }
-        UAQSQuest* quest = questStruct->Quest;
-        if (!quest) {
-            continue;
+    const UAQSQuest* questTemplate = GetQuestTemplate(questTag);
+    if (!questTemplate) {
+        return nullptr;
+    }
+
+    UAQSQuest* quest = DuplicateObject(questTemplate, GetOuter());
+    const FAQSQuestRecord* endedRecord = endedQuestsRecords.Find(questTag);
+    if (endedRecord) {
+        quest->SetCompletedObjectives(endedRecord->CompletedObjectives);
+    }
+    loadedQuests.Add(questTag, quest);
+    return quest;
+}
+
+void UAQSQuestManagerComponent::AddEndedQuestRecord(const FGameplayTag& questTag)
+{
+    FAQSQuestRecord& endedRecord = endedQuestsRecords.FindOrAdd(questTag);
+    endedRecord.Quest = questTag;
+    endedRecord.Objectives.Empty();
+
+    const UAQSQuest* quest = FindLoadedQuest(questTag);
+    if (quest) {
+        endedRecord.CompletedObjectives = quest->GetCompletedObjectives();
+    }
+}
+
+bool UAQSQuestManagerComponent::TryGetEndedQuestRecord(const FGameplayTag& questTag, FAQSQuestRecord& outRecord) const
+{
+    const FAQSQuestRecord* endedRecord = endedQuestsRecords.Find(questTag);
+    if (endedRecord) {
+        outRecord = *endedRecord;
+        return true;
+    }
+    return false;
+}
+
+TArray<UAQSQuest*> UAQSQuestManagerComponent::GetCompletedQuests()
+{
+    TArray<UAQSQuest*> quests;
+    quests.Reserve(CompletedQuestsTags.Num());
+    for (const FGameplayTag& questTag : CompletedQuestsTags) {
+        UAQSQuest* quest = GetQuest(questTag);
+        if (quest) {
+            quests.Add(quest);
         }
-        if (quest->GetQuestTag() == questTag) {
-            newQuest = DuplicateObject(quest, GetOuter());
-            loadedQuests.Add(questTag, newQuest);
-            return newQuest;
+    }
+    return quests;
+}
+
+TArray<UAQSQuest*> UAQSQuestManagerComponent::GetFailedQuests()
+{
+    TArray<UAQSQuest*> quests;
+    quests.Reserve(FailedQuestsTags.Num());
+    for (const FGameplayTag& questTag : FailedQuestsTags) {
+        UAQSQuest* quest = GetQuest(questTag);
+        if (quest) {
+            quests.Add(quest);
         }
     }
+    return quests;
+}
+
+const UAQSQuest* UAQSQuestManagerComponent::GetQuestTemplate(const FGameplayTag& questTag) const
+{
+    if (!QuestsDB) {
+        UE_LOG(LogTemp, Error, TEXT("Missing Quests Database from Quest Manager! - UAQSQuestManagerComponent::GetQuestTemplate"));
+        return nullptr;
+    }
+
+    UAQSQuestSubsystem* questSubsystem = GetQuestSubsystem();
+    if (questSubsystem) {
+        return questSubsystem->GetQuestTemplate(QuestsDB, questTag);
+    }
     return nullptr;
 }
 
-class UAQSQuest* UAQSQuestManagerComponent::GetQuest(const FGameplayTag& questTag) const
+UAQSQuestSubsystem* UAQSQuestManagerComponent::GetQuestSubsystem() const
 {
-    if (loadedQuests.Contains(questTag)) {
-        return loadedQuests.FindChecked(questTag);
+    const UGameInstance* gameInstance = UGameplayStatics::GetGameInstance(this);
+    if (gameInstance) {
+        return gameInstance->GetSubsystem<UAQSQuestSubsystem>();
     }
     return nullptr;
 }
 
-class UAQSQuestObjective* UAQSQuestManagerComponent::GetQuestObjectiveFromDB(const FGameplayTag& objectiveTag, const FGameplayTag& questTag) const
+void UAQSQuestManagerComponent::ReleaseQuestInstance(const FGameplayTag& questTag)
+{
+    const UAQSQuest* quest = FindLoadedQuest(questTag);
+    if (quest && quest != TrackedQuest) {
+        loadedQuests.Remove(questTag);
+    }
+}
+
+class UAQSQuestObjective* UAQSQuestManagerComponent::GetQuestObjectiveFromDB(const FGameplayTag& objectiveTag, const FGameplayTag& questTag)
 {
     const UAQSQuest* quest = GetQuest(questTag);
     if (quest) {
@@ -296,15 +386,13 @@ bool UAQSQuestManagerComponent::TryGetInProgressObjectiveInfo(const FGameplayTag
         return false;
     }
 
-    const UAQSQuest* quest = GetQuest(questTag);
-    if (quest) {
-        const UAQSObjectiveNode* node = quest->GetActiveObjectiveNode(objectiveTag);
-        if (node) {
-            const UAQSQuestObjective* objective = node->GetQuestObjective();
-            if (objective) {
-                outObjectiveInfo = FAQSObjectiveInfo(objective, *objectiveRec);
-                return true;
-            }
+    /*the record holds the progress, the template is enough for the static data*/
+    const UAQSQuest* questTemplate = GetQuestTemplate(questTag);
+    if (questTemplate) {
+        const UAQSQuestObjective* objective = questTemplate->GetObjectiveByTag(objectiveTag);
+        if (objective) {
+            outObjectiveInfo = FAQSObjectiveInfo(objective, *objectiveRec);
+            return true;
         }
     }
     return false;
@@ -322,9 +410,9 @@ bool UAQSQuestManagerComponent::TryGetInProgressQuestInfo(const FGameplayTag& qu
         return false;
     }
 
-    const UAQSQuest* quest = GetQuest(questTag);
-    if (quest) {
-        outQuestInfo = FAQSQuestInfo(quest, *questRec);
+    const UAQSQuest* questTemplate = GetQuestTemplate(questTag);
+    if (questTemplate) {
+        outQuestInfo = FAQSQuestInfo(questTemplate, *questRec);
         return true;
     }
 
@@ -348,10 +436,15 @@ bool UAQSQuestManagerComponent::IsObjectiveCompletedByTag(const FGameplayTag& qu
     if (IsQuestCompletedByTag(questTag)) {
         return true;
     } else if (IsQuestInProgressByTag(questTag)) {
-        UAQSQuest* quest = GetQuest(questTag);
+        const UAQSQuest* quest = FindLoadedQuest(questTag);
         if (quest) {
             return quest->IsObjectiveCompleted(objectiveTag);
         }
+    } else {
+        const FAQSQuestRecord* endedRecord = endedQuestsRecords.Find(questTag);
+        if (endedRecord) {
+            return endedRecord->CompletedObjectives.Contains(objectiveTag);
+        }
     }
 
     return false;
@@ -369,11 +462,10 @@ void UAQSQuestManagerComponent::GetInProgressQuestsInfo(TArray<FAQSQuestInfo>& o
 
 bool UAQSQuestManagerComponent::CompleteBranchedObjective(FGameplayTag objectiveToComplete, TArray<FName> optionalTransitionFilters)
 {
-    for (UAQSQuest* quest : InProgressQuests) {
-        if (quest->HasActiveObjective(objectiveToComplete)) {
-            const bool bCompleted = quest->CompleteBranchedObjective(objectiveToComplete, optionalTransitionFilters);
-            return bCompleted;
-        }
+    const TArray<UAQSQuest*>* listeners = objectiveListeners.Find(objectiveToComplete);
+    if (listeners && listeners->Num() > 0) {
+        UAQSQuest* quest = (*listeners)[0];
+        return quest->CompleteBranchedObjective(objectiveToComplete, optionalTransitionFilters);
     }
     return false;
 }
@@ -443,7 +535,8 @@ void UAQSQuestManagerComponent::UnregisterTarget(class UAQSQuestTargetComponent*
 
 void UAQSQuestManagerComponent::DispatchObjectiveUpdate(const FGameplayTag& objectiveTag, const FGameplayTag& questTag, EQuestUpdateType updateType)
 {
-    const UAQSQuest* quest = GetQuestFromDB(questTag);
+    /*only loaded quests have active objectives, looking ended or unstarted ones up would instance them*/
+    const UAQSQuest* quest = FindLoadedQuest(questTag);
     if (!quest) {
         return;
     }
@@ -453,45 +546,179 @@ void UAQSQuestManagerComponent::DispatchObjectiveUpdate(const FGameplayTag& obje
         return;
     }
 
+    /*the same update dispatched more than once in a frame is broadcasted only once*/
+    const bool bAlreadyPending = pendingObjectiveUpdates.ContainsByPredicate([&](const FAQSPendingObjectiveUpdate& update) {
+        return update.Objective == objectiveTag && update.Quest == questTag && update.UpdateType == updateType;
+    });
+    if (!bAlreadyPending) {
+        FAQSPendingObjectiveUpdate& update = pendingObjectiveUpdates.AddDefaulted_GetRef();
+        update.Objective = objectiveTag;
+        update.Quest = questTag;
+        update.UpdateType = updateType;
+        update.QuestObjective = questObjective;
+    }
+
+    if (bObjectiveUpdatesFlushPending) {
+        return;
+    }
+
+    UWorld* world = GetWorld();
+    if (world) {
+        bObjectiveUpdatesFlushPending = true;
+        world->GetTimerManager().SetTimerForNextTick(this, &UAQSQuestManagerComponent::FlushObjectiveUpdates);
+    } else {
+        FlushObjectiveUpdates();
+    }
+}
+
+void UAQSQuestManagerComponent::FlushObjectiveUpdates()
+{
+    bObjectiveUpdatesFlushPending = false;
+    if (pendingObjectiveUpdates.Num() == 0) {
+        return;
+    }
+
+    // listeners may dispatch new updates, those will be flushed on the next frame
+    const TArray<FAQSPendingObjectiveUpdate> updates = MoveTemp(pendingObjectiveUpdates);
+    pendingObjectiveUpdates.Reset();
+
     OnInProgressQuestsUpdate.Broadcast();
 
-    bool bIsTracked = false;
-    if (GetCurrentlyTrackedQuestTag() == questTag) {
-        bIsTracked = true;
+    const FGameplayTag trackedQuestTag = GetCurrentlyTrackedQuestTag();
+    const bool bTrackedQuestUpdated = updates.ContainsByPredicate([&](const FAQSPendingObjectiveUpdate& update) {
+        return update.Quest == trackedQuestTag;
+    });
+    if (bTrackedQuestUpdated) {
         OnTrackedQuestUpdated.Broadcast();
     }
 
-    switch (updateType) {
-    case EQuestUpdateType::EStarted:
+    for (const FAQSPendingObjectiveUpdate& update : updates) {
+        switch (update.UpdateType) {
+        case EQuestUpdateType::EStarted:
 
-        OnObjectiveStarted.Broadcast(questObjective->GetObjectiveTag(), questTag);
-        break;
-    case EQuestUpdateType::ECompleted:
+            OnObjectiveStarted.Broadcast(update.Objective, update.Quest);
+            break;
+        case EQuestUpdateType::ECompleted:
 
-        OnObjectiveCompleted.Broadcast(questObjective->GetObjectiveTag(), questTag);
-        break;
-    case EQuestUpdateType::EUpdated:
+            OnObjectiveCompleted.Broadcast(update.Objective, update.Quest);
+            break;
+        case EQuestUpdateType::EUpdated:
 
-        OnObjectiveUpdated.Broadcast(questObjective->GetObjectiveTag(), questTag);
-        break;
-    case EQuestUpdateType::EInterrupted:
-        OnObjectiveInterrupted.Broadcast(questObjective->GetObjectiveTag(), questTag);
-        break;
+            OnObjectiveUpdated.Broadcast(update.Objective, update.Quest);
+            break;
+        case EQuestUpdateType::EInterrupted:
+            OnObjectiveInterrupted.Broadcast(update.Objective, update.Quest);
+            break;
+        }
+
+        const UAQSQuestObjective* questObjective = update.QuestObjective.Get();
+        if (!questObjective) {
+            continue;
+        }
+
+        const bool bIsTracked = update.Quest == trackedQuestTag;
+        TArray<UAQSQuestTargetComponent*> targetComps = questObjective->GetObjectiveTargets();
+        for (UAQSQuestTargetComponent* targetComp : targetComps) {
+
+            if (targetComp) {
+                targetComp->DispatchObjectiveUpdated(update.Objective, update.Quest, update.UpdateType, bIsTracked);
+            } else {
+                UE_LOG(LogTemp, Error, TEXT("Quest References without AQSTargetActorComponent! - UAQSQuestManagerComponent::FlushObjectiveUpdates"));
+            }
+        }
     }
-    TArray<UAQSQuestTargetComponent*> targetComps = questObjective->GetObjectiveTargets();
-    for (UAQSQuestTargetComponent* targetComp : targetComps) {
+}
 
-        if (targetComp) {
-            targetComp->DispatchObjectiveUpdated(objectiveTag, questTag, updateType, bIsTracked);
-        } else {
-            UE_LOG(LogTemp, Error, TEXT("Quest References without AQSTargetActorComponent! - UAQSObjectiveNode::UpdateReferences"));
+void UAQSQuestManagerComponent::RegisterObjectiveListener(const FGameplayTag& objectiveTag, UAQSQuest* quest)
+{
+    if (quest && objectiveTag != FGameplayTag()) {
+        objectiveListeners.FindOrAdd(objectiveTag).AddUnique(quest);
+    }
+}
+
+void UAQSQuestManagerComponent::UnregisterObjectiveListener(const FGameplayTag& objectiveTag, UAQSQuest* quest)
+{
+    TArray<UAQSQuest*>* listeners = objectiveListeners.Find(objectiveTag);
+    if (listeners) {
+        listeners->Remove(quest);
+        if (listeners->Num() == 0) {
+            objectiveListeners.Remove(objectiveTag);
         }
     }
 }
 
+void UAQSQuestManagerComponent::UnregisterQuestListeners(UAQSQuest* quest)
+{
+    for (auto it = objectiveListeners.CreateIterator(); it; ++it) {
+        it.Value().Remove(quest);
+        if (it.Value().Num() == 0) {
+            it.RemoveCurrent();
+        }
+    }
+}
+
+void UAQSQuestManagerComponent::AddInProgressRecord(const FAQSQuestRecord& record)
+{
+    if (InProgressQuestsRecords.Contains(record)) {
+        return;
+    }
+    InProgressQuestsRecords.Add(record);
+    CountRecordObjectives(record, 1);
+    if (GetOwnerRole() == ROLE_Authority) {
+        InProgressQuestsProgress.SetQuestRecord(record);
+    }
+}
+
+void UAQSQuestManagerComponent::RemoveInProgressRecord(const FGameplayTag& questTag)
+{
+    const int32 index = InProgressQuestsRecords.IndexOfByKey(questTag);
+    if (index == INDEX_NONE) {
+        return;
+    }
+    CountRecordObjectives(InProgressQuestsRecords[index], -1);
+    InProgressQuestsRecords.RemoveAt(index);
+    if (GetOwnerRole() == ROLE_Authority) {
+        InProgressQuestsProgress.RemoveQuest(questTag);
+    }
+}
+
+void UAQSQuestManagerComponent::UpdateInProgressRecord(const FAQSQuestRecord& record)
+{
+    const int32 index = InProgressQuestsRecords.IndexOfByKey(record.Quest);
+    if (index == INDEX_NONE) {
+        AddInProgressRecord(record);
+        return;
+    }
+    CountRecordObjectives(InProgressQuestsRecords[index], -1);
+    InProgressQuestsRecords[index] = record;
+    CountRecordObjectives(record, 1);
+    if (GetOwnerRole() == ROLE_Authority) {
+        InProgressQuestsProgress.SetQuestRecord(record);
+    }
+}
+
+void UAQSQuestManagerComponent::CountRecordObjectives(const FAQSQuestRecord& record, int32 delta)
+{
+    for (const FAQSObjectiveRecord& objective : record.Objectives) {
+        int32& count = inProgressObjectives.FindOrAdd(objective.Objective);
+        count += delta;
+        if (count <= 0) {
+            inProgressObjectives.Remove(objective.Objective);
+        }
+    }
+}
+
+void UAQSQuestManagerComponent::RebuildInProgressObjectives()
+{
+    inProgressObjectives.Reset();
+    for (const FAQSQuestRecord& record : InProgressQuestsRecords) {
+        CountRecordObjectives(record, 1);
+    }
+}
+
 void UAQSQuestManagerComponent::ServerDispatchObjectiveUpdate_Implementation(const FGameplayTag& objectiveTag, const FGameplayTag& questTag, EQuestUpdateType updateType)
 {
-    const UAQSQuest* quest = GetQuestFromDB(questTag);
+    const UAQSQuest* quest = FindLoadedQuest(questTag);
     if (!quest) {
         return;
     }
@@ -501,10 +728,7 @@ void UAQSQuestManagerComponent::ServerDispatchObjectiveUpdate_Implementation(con
         return;
     }
 
-    if (InProgressQuestsRecords.Contains(questTag)) {
-        InProgressQuestsRecords.Remove(FAQSQuestRecord(quest));
-    }
-    InProgressQuestsRecords.AddUnique(FAQSQuestRecord(quest));
+    UpdateInProgressRecord(FAQSQuestRecord(quest));
     OnInProgressQuestsUpdate.Broadcast();
 
     switch (updateType) {
@@ -570,12 +794,16 @@ void UAQSQuestManagerComponent::ReloadFromRecords(const TArray<FAQSQuestRecord>&
     CompletedQuestsTags = inCompletedQuests;
     FailedQuestsTags = inFailedQuests;
     TrackedQuestTag = inTrackedQuest;
+    RebuildInProgressObjectives();
+    if (GetOwnerRole() == ROLE_Authority) {
+        InProgressQuestsProgress.Rebuild(InProgressQuestsRecords);
+    }
     OnComponentLoaded();
 }
 
 void UAQSQuestManagerComponent::DEBUG_ProceedQuest(const FGameplayTag& inProgressQuest)
 {
-    UAQSQuest* quest = GetQuest(inProgressQuest);
+    const UAQSQuest* quest = FindLoadedQuest(inProgressQuest);
     if (quest) {
         const TArray<UAQSQuestObjective*> objectives = quest->GetAllActiveObjectives();
         for (const auto& obj : objectives) {
@@ -594,22 +822,64 @@ void UAQSQuestManagerComponent::OnRep_TrackedQuest()
     OnTrackedQuestChanged.Broadcast();
 }
 
-void UAQSQuestManagerComponent::OnRep_InProgressQuestsRecords()
+void UAQSQuestManagerComponent::OnRep_FailedQuestsTags(const TArray<FGameplayTag>& previousTags)
 {
-    SyncGraphs();
-    OnInProgressQuestsUpdate.Broadcast();
+    if (!ApplyEndedQuests(previousTags, FailedQuestsTags)) {
+        SyncGraphs();
+    }
+    OnFailedQuestsUpdate.Broadcast();
 }
 
-void UAQSQuestManagerComponent::OnRep_FailedQuestsTags()
+void UAQSQuestManagerComponent::OnRep_CompletedQuestsTags(const TArray<FGameplayTag>& previousTags)
 {
-    SyncGraphs();
-    OnFailedQuestsUpdate.Broadcast();
+    if (!ApplyEndedQuests(previousTags, CompletedQuestsTags)) {
+        SyncGraphs();
+    }
+    OnCompletedQuestsUpdate.Broadcast();
 }
 
-void UAQSQuestManagerComponent::OnRep_CompletedQuestsTags()
+bool UAQSQuestManagerComponent::ApplyEndedQuests(const TArray<FGameplayTag>& previousTags, const TArray<FGameplayTag>& endedTags)
 {
-    SyncGraphs();
-    OnCompletedQuestsUpdate.Broadcast();
+    // during play the history only grows, anything else comes from a reload
+    if (endedTags.Num() < previousTags.Num()) {
+        return false;
+    }
+    for (int32 index = 0; index < previousTags.Num(); index++) {
+        if (endedTags[index] != previousTags[index]) {
+            return false;
+        }
+    }
+
+    for (int32 index = previousTags.Num(); index < endedTags.Num(); index++) {
+        const FGameplayTag& questTag = endedTags[index];
+        UAQSQuest* quest = FindLoadedQuest(questTag);
+        if (quest) {
+            InProgressQuests.Remove(quest);
+            UnregisterQuestListeners(quest);
+        }
+        AddEndedQuestRecord(questTag);
+        ReleaseQuestInstance(questTag);
+    }
+    return true;
+}
+
+void UAQSQuestManagerComponent::HandleQuestProgressReplicated(const TSet<FGameplayTag>& changedQuests)
+{
+    for (const FGameplayTag& questTag : changedQuests) {
+        FAQSQuestRecord record;
+        if (InProgressQuestsProgress.BuildQuestRecord(questTag, record)) {
+            UpdateInProgressRecord(record);
+            SyncQuestGraph(record);
+        } else {
+            RemoveInProgressRecord(questTag);
+            UAQSQuest* quest = FindLoadedQuest(questTag);
+            if (quest) {
+                InProgressQuests.Remove(quest);
+                UnregisterQuestListeners(quest);
+            }
+        }
+    }
+    OnInProgressQuestsUpdate.Broadcast();
 }
 
 void UAQSQuestManagerComponent::HandleQuestCompleted(const FGameplayTag& questToComplete, bool bSuccesful)
@@ -622,14 +892,15 @@ void UAQSQuestManagerComponent::HandleQuestCompleted(const FGameplayTag& questTo
                 UntrackCurrentQuest();
             }
             InProgressQuests.Remove(quest);
-            InProgressQuestsRecords.Remove(FAQSQuestRecord(quest));
+            RemoveInProgressRecord(questToComplete);
+            UnregisterQuestListeners(quest);
 
+            /*ended quests only keep a record of their completed objectives*/
+            AddEndedQuestRecord(questToComplete);
             if (bSuccesful) {
-                CompletedQuests.Add(quest);
                 CompletedQuestsTags.Add(questToComplete);
                 OnCompletedQuestsUpdate.Broadcast();
             } else {
-                FailedQuests.Add(quest);
                 FailedQuestsTags.Add(questToComplete);
                 OnFailedQuestsUpdate.Broadcast();
             }
@@ -638,6 +909,7 @@ void UAQSQuestManagerComponent::HandleQuestCompleted(const FGameplayTag& questTo
             quest->OnObjectiveStarted.RemoveDynamic(this, &UAQSQuestManagerComponent::HandleObjectiveStarted);
             quest->OnObjectiveCompleted.RemoveDynamic(this, &UAQSQuestManagerComponent::HandleObjectiveCompleted);
             quest->OnObjectiveUpdated.RemoveDynamic(this, &UAQSQuestManagerComponent::HandleObjectiveUpdated);
+            ReleaseQuestInstance(questToComplete);
         }
 
         OnQuestEnded.Broadcast(questToComplete, bSuccesful);
@@ -673,46 +945,60 @@ void UAQSQuestManagerComponent::HandleObjectiveUpdated(const FGameplayTag& objec
 
 void UAQSQuestManagerComponent::SyncGraphs()
 {
-    CompletedQuests.Empty();
-    FailedQuests.Empty();
     InProgressQuests.Empty();
-    for (const auto& questData : CompletedQuestsTags) {
-        UAQSQuest* quest = GetQuestFromDB(questData);
-        if (quest) {
-            CompletedQuests.Add(quest);
+    objectiveListeners.Reset();
+
+    for (auto it = endedQuestsRecords.CreateIterator(); it; ++it) {
+        if (!IsQuestCompletedByTag(it.Key()) && !IsQuestFailedByTag(it.Key())) {
+            it.RemoveCurrent();
         }
     }
+    endedQuestsRecords.Reserve(CompletedQuestsTags.Num() + FailedQuestsTags.Num());
+    for (const auto& questData : CompletedQuestsTags) {
+        AddEndedQuestRecord(questData);
+        ReleaseQuestInstance(questData);
+    }
 
     for (const auto& questData : FailedQuestsTags) {
-        UAQSQuest* quest = GetQuestFromDB(questData);
-        if (quest) {
-            FailedQuests.Add(quest);
-        }
+        AddEndedQuestRecord(questData);
+        ReleaseQuestInstance(questData);
     }
 
     // this NEEDS to be a copy! Otherwise the quest update will override it
     TArray<FAQSQuestRecord> tempRecords = InProgressQuestsRecords;
     for (const auto& questData : tempRecords) {
-        UAQSQuest* quest = GetQuestFromDB(questData.Quest);
+        SyncQuestGraph(questData);
+    }
 
-        if (quest) {
-            if (Internal_StartQuest(quest, false, false)) {
-                quest->SetCompletedObjectives(questData.CompletedObjectives);
-                for (const auto& obj : questData.Objectives) {
-                    UAQSObjectiveNode* objNode = quest->GetObjectiveNode(obj.Objective);
-                    if (objNode) {
-                        quest->ActivateNode(objNode);
-                        objNode->SetCurrentRepetitions(obj.CurrentRepetitions);
-                    }
-                }
-            } else {
-                UE_LOG(LogTemp, Error, TEXT("Impossible To Start Quest - UAQSQuestManagerComponent::OnComponentLoaded"));
+    UAQSQuest* quest = GetQuestFromDB(TrackedQuestTag);
+    if (quest) {
+        TrackInProgressQuest(quest);
+    }
+}
+
+void UAQSQuestManagerComponent::SyncQuestGraph(const FAQSQuestRecord& questData)
+{
+    UAQSQuest* quest = GetQuestFromDB(questData.Quest);
+    if (!quest) {
+        return;
+    }
+
+    InProgressQuests.Remove(quest);
+    UnregisterQuestListeners(quest);
+    if (Internal_StartQuest(quest, false, false)) {
+        quest->SetCompletedObjectives(questData.CompletedObjectives);
+        for (const auto& obj : questData.Objectives) {
+            UAQSObjectiveNode* objNode = quest->GetObjectiveNode(obj.Objective);
+            if (objNode) {
+                quest->ActivateNode(objNode);
+                objNode->SetCurrentRepetitions(obj.CurrentRepetitions);
             }
         }
+    } else {
+        UE_LOG(LogTemp, Error, TEXT("Impossible To Start Quest - UAQSQuestManagerComponent::SyncQuestGraph"));
     }
 
-    UAQSQuest* quest = GetQuestFromDB(TrackedQuestTag);
-    if (quest) {
+    if (TrackedQuestTag == questData.Quest && TrackedQuest != quest) {
         TrackInProgressQuest(quest);
     }
 }
@@ -721,7 +1007,8 @@ bool UAQSQuestManagerComponent::RemoveInProgressQuest(UAQSQuest* quest)
 {
     if (IsQuestInProgress(quest)) {
         InProgressQuests.Remove(quest);
-        InProgressQuestsRecords.Remove(FAQSQuestRecord(quest));
+        RemoveInProgressRecord(quest->GetQuestTag());
+        UnregisterQuestListeners(quest);
         return true;
     }
     return false;
@@ -0,0 +1,63 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "AQSQuestSubsystem.h"
+#include "AQSTypes.h"
+#include "Engine/DataTable.h"
+#include "Graph/AQSQuest.h"
+
+void UAQSQuestSubsystem::Deinitialize()
+{
+    indexedDBs.Empty();
+    Super::Deinitialize();
+}
+
+const UAQSQuest* UAQSQuestSubsystem::GetQuestTemplate(const UDataTable* questsDB, const FGameplayTag& questTag)
+{
+    const FAQSQuestsDBIndex* index = FindOrBuildIndex(questsDB);
+    if (index) {
+        const TObjectPtr<UAQSQuest>* quest = index->Templates.Find(questTag);
+        if (quest) {
+            return *quest;
+        }
+    }
+    return nullptr;
+}
+
+void UAQSQuestSubsystem::IndexQuestsDB(const UDataTable* questsDB)
+{
+    FindOrBuildIndex(questsDB);
+}
+
+void UAQSQuestSubsystem::InvalidateQuestsDB(const UDataTable* questsDB)
+{
+    indexedDBs.Remove(const_cast<UDataTable*>(questsDB));
+}
+
+const FAQSQuestsDBIndex* UAQSQuestSubsystem::FindOrBuildIndex(const UDataTable* questsDB)
+{
+    if (!questsDB) {
+        return nullptr;
+    }
+
+    UDataTable* dbKey = const_cast<UDataTable*>(questsDB);
+    const FAQSQuestsDBIndex* existingIndex = indexedDBs.Find(dbKey);
+    if (existingIndex) {
+        return existingIndex;
+    }
+
+    FAQSQuestsDBIndex& newIndex = indexedDBs.Add(dbKey);
+    newIndex.Templates.Reserve(questsDB->GetRowMap().Num());
+    for (const auto& it : questsDB->GetRowMap()) {
+        const FAQSQuestData* questStruct = (const FAQSQuestData*)(it.Value);
+        if (!questStruct || !questStruct->Quest) {
+            continue;
+        }
+        const FGameplayTag questTag = questStruct->Quest->GetQuestTag();
+        if (newIndex.Templates.Contains(questTag)) {
+            UE_LOG(LogTemp, Warning, TEXT("Duplicated quest tag %s in %s - UAQSQuestSubsystem::FindOrBuildIndex"), *questTag.ToString(), *questsDB->GetName());
+            continue;
+        }
+        newIndex.Templates.Add(questTag, questStruct->Quest);
+    }
+    return &newIndex;
+}
@@ -2,6 +2,7 @@
 
 
 #include "AQSTypes.h"
+#include "AQSQuestManagerComponent.h"
 #include "Graph/AQSQuest.h"
 
 FAQSQuestRecord::FAQSQuestRecord(const  UAQSQuest* quest)
@@ -16,4 +17,121 @@ FAQSQuestRecord::FAQSQuestRecord(const  UAQSQuest* quest)
         CompletedObjectives = quest->GetCompletedObjectives();
     }
 
-}
\ No newline at end of file
+}
+
+void FAQSQuestProgressArray::SetQuestRecord(const FAQSQuestRecord& record)
+{
+    TBitArray<> visitedItems(false, Items.Num());
+
+    const auto setEntry = [&](const FGameplayTag& objective, int32 repetitions, bool bCompletedEntry) {
+        for (int32 index = 0; index < Items.Num(); index++) {
+            FAQSQuestProgressItem& item = Items[index];
+            if (!visitedItems[index] && item.Quest == record.Quest && item.Objective == objective && item.bCompleted == bCompletedEntry) {
+                visitedItems[index] = true;
+                if (item.CurrentRepetitions != repetitions) {
+                    item.CurrentRepetitions = repetitions;
+                    MarkItemDirty(item);
+                }
+                return;
+            }
+        }
+
+        FAQSQuestProgressItem& newItem = Items.AddDefaulted_GetRef();
+        newItem.Quest = record.Quest;
+        newItem.Objective = objective;
+        newItem.CurrentRepetitions = repetitions;
+        newItem.bCompleted = bCompletedEntry;
+        MarkItemDirty(newItem);
+        visitedItems.Add(true);
+    };
+
+    setEntry(FGameplayTag(), 0, false);
+    for (const FAQSObjectiveRecord& objective : record.Objectives) {
+        setEntry(objective.Objective, objective.CurrentRepetitions, false);
+    }
+    for (const FGameplayTag& objective : record.CompletedObjectives) {
+        setEntry(objective, 0, true);
+    }
+
+    bool bRemoved = false;
+    for (int32 index = Items.Num() - 1; index >= 0; index--) {
+        if (!visitedItems[index] && Items[index].Quest == record.Quest) {
+            Items.RemoveAtSwap(index);
+            bRemoved = true;
+        }
+    }
+    if (bRemoved) {
+        MarkArrayDirty();
+    }
+}
+
+void FAQSQuestProgressArray::RemoveQuest(const FGameplayTag& questTag)
+{
+    const int32 removed = Items.RemoveAllSwap([&](const FAQSQuestProgressItem& item) {
+        return item.Quest == questTag;
+    });
+    if (removed > 0) {
+        MarkArrayDirty();
+    }
+}
+
+void FAQSQuestProgressArray::Rebuild(const TArray<FAQSQuestRecord>& records)
+{
+    Items.Reset();
+    for (const FAQSQuestRecord& record : records) {
+        SetQuestRecord(record);
+    }
+    MarkArrayDirty();
+}
+
+bool FAQSQuestProgressArray::BuildQuestRecord(const FGameplayTag& questTag, FAQSQuestRecord& outRecord) const
+{
+    bool bFound = false;
+    outRecord = FAQSQuestRecord();
+    outRecord.Quest = questTag;
+    for (const FAQSQuestProgressItem& item : Items) {
+        if (item.Quest != questTag) {
+            continue;
+        }
+        if (!item.Objective.IsValid()) {
+            bFound = true;
+        } else if (item.bCompleted) {
+            outRecord.CompletedObjectives.Add(item.Objective);
+        } else {
+            FAQSObjectiveRecord objective;
+            objective.Objective = item.Objective;
+            objective.CurrentRepetitions = item.CurrentRepetitions;
+            outRecord.Objectives.Add(objective);
+        }
+    }
+    return bFound;
+}
+
+void FAQSQuestProgressArray::PreReplicatedRemove(const TArrayView<int32>& removedIndices, int32 finalSize)
+{
+    for (const int32 index : removedIndices) {
+        changedQuests.Add(Items[index].Quest);
+    }
+}
+
+void FAQSQuestProgressArray::PostReplicatedAdd(const TArrayView<int32>& addedIndices, int32 finalSize)
+{
+    for (const int32 index : addedIndices) {
+        changedQuests.Add(Items[index].Quest);
+    }
+}
+
+void FAQSQuestProgressArray::PostReplicatedChange(const TArrayView<int32>& changedIndices, int32 finalSize)
+{
+    for (const int32 index : changedIndices) {
+        changedQuests.Add(Items[index].Quest);
+    }
+}
+
+void FAQSQuestProgressArray::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& parameters)
+{
+    if (owner && changedQuests.Num() > 0) {
+        owner->HandleQuestProgressReplicated(changedQuests);
+    }
+    changedQuests.Reset();
+}
@@ -97,6 +97,11 @@ FGameplayTag UAQSObjectiveNode::GetObjectiveTag() const
     return Objective->GetObjectiveTag();
 }
 
+FGameplayTag UAQSObjectiveNode::GetNodeTag() const
+{
+    return Objective ? Objective->GetObjectiveTag() : FGameplayTag();
+}
+
 void UAQSObjectiveNode::InterruptObjective()
 {
     bInterrupted = true;
@@ -2,6 +2,7 @@
 
 #include "Graph/AQSQuest.h"
 #include "AGSGraphNode.h"
+#include "AQSQuestManagerComponent.h"
 #include "Graph/AQSBaseNode.h"
 #include "Graph/AQSEdge.h"
 #include "Graph/AQSObjectiveNode.h"
@@ -10,8 +11,26 @@
 
 bool UAQSQuest::ActivateNode(class UAGSGraphNode* node)
 {
+    const bool bActivated = Super::ActivateNode(node);
+    const UAQSObjectiveNode* objectiveNode = Cast<UAQSObjectiveNode>(node);
+    if (bActivated && objectiveNode && questManager) {
+        questManager->RegisterObjectiveListener(objectiveNode->GetObjectiveTag(), this);
+    }
+    return bActivated;
+}
 
-    return Super::ActivateNode(node);
+bool UAQSQuest::DeactivateNode(class UAGSGraphNode* node)
+{
+    const bool bDeactivated = Super::DeactivateNode(node);
+    const UAQSObjectiveNode* objectiveNode = Cast<UAQSObjectiveNode>(node);
+    if (bDeactivated && objectiveNode && questManager) {
+        const FGameplayTag objectiveTag = objectiveNode->GetObjectiveTag();
+        /*another active node of this quest could still listen to the same objective*/
+        if (!HasActiveObjective(objectiveTag)) {
+            questManager->UnregisterObjectiveListener(objectiveTag, this);
+        }
+    }
+    return bDeactivated;
 }
 
 UAQSQuest::UAQSQuest()
@@ -63,13 +82,7 @@ UAQSQuestObjective* UAQSQuest::GetActiveObjective(const FGameplayTag& objectiveT
 
 UAQSObjectiveNode* UAQSQuest::GetObjectiveNode(const FGameplayTag& objectiveTag) const
 {
-    for (const auto obj : GetAllNodes()) {
-        UAQSObjectiveNode* objNode = Cast<UAQSObjectiveNode>(obj);
-        if (objNode && objNode->GetObjectiveTag() == objectiveTag) {
-            return objNode;
-        }
-    }
-    return nullptr;
+    return Cast<UAQSObjectiveNode>(FindNodeByTag(objectiveTag));
 }
 
 TArray<UAQSQuestObjective*> UAQSQuest::GetAllActiveObjectives() const
@@ -88,13 +101,8 @@ TArray<UAQSQuestObjective*> UAQSQuest::GetAllActiveObjectives() const
 
 UAQSQuestObjective* UAQSQuest::GetObjectiveByTag(const FGameplayTag& objectiveTag) const
 {
-    for (const auto obj : GetAllNodes()) {
-        UAQSObjectiveNode* objNode = Cast<UAQSObjectiveNode>(obj);
-        if (objNode && objNode->GetObjectiveTag() == objectiveTag) {
-            return objNode->GetQuestObjective();
-        }
-    }
-    return nullptr;
+    const UAQSObjectiveNode* objNode = GetObjectiveNode(objectiveTag);
+    return objNode ? objNode->GetQuestObjective() : nullptr;
 }
 
 bool UAQSQuest::StartQuest(class APlayerController* inController, TObjectPtr<UAQSQuestManagerComponent> inQuestManager, bool bActivateChildNodes /*= true*/)
@@ -15,6 +15,7 @@
 class UAQSQuestObjective;
 class UAQSQuestTargetComponent;
 class UAQSQuest;
+class UAQSQuestSubsystem;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInProgressQuestsUpdate);
 
@@ -24,10 +25,23 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnFailedQuestsUpdate);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnTrackedQuestUpdate);
 
+/*An objective update waiting to be broadcasted at the end of the frame*/
+struct FAQSPendingObjectiveUpdate {
+    FGameplayTag Objective;
+
+    FGameplayTag Quest;
+
+    EQuestUpdateType UpdateType;
+
+    TWeakObjectPtr<const UAQSQuestObjective> QuestObjective;
+};
+
 UCLASS(Blueprintable, ClassGroup = (ATS), meta = (BlueprintSpawnableComponent))
 class ASCENTQUESTSYSTEM_API UAQSQuestManagerComponent : public UActorComponent {
     GENERATED_BODY()
 
+    friend struct FAQSQuestProgressArray;
+
 public:
     // Sets default values for this component's properties
     UAQSQuestManagerComponent();
@@ -127,17 +141,13 @@ public:
         return InProgressQuests;
     }
 
+    /*Ended quests are instanced on demand from their template and record, prefer
+    GetEndedQuestRecord when only the completed objectives are needed*/
     UFUNCTION(BlueprintPure, Category = "AQS| Server")
-    FORCEINLINE TArray<class UAQSQuest*> GetCompletedQuests() const
-    {
-        return CompletedQuests;
-    }
+    TArray<class UAQSQuest*> GetCompletedQuests();
 
     UFUNCTION(BlueprintPure, Category = "AQS| Server")
-    FORCEINLINE TArray<class UAQSQuest*> GetFailedQuests() const
-    {
-        return FailedQuests;
-    }
+    TArray<class UAQSQuest*> GetFailedQuests();
 
     UFUNCTION(BlueprintPure, Category = "AQS| Server")
     FORCEINLINE class UAQSQuest* GetCurrentlyTrackedQuest() const
@@ -158,16 +168,29 @@ public:
 
     /*SERVER & CLIENT GETTERS*/
     UFUNCTION(BlueprintPure, Category = AQS)
-    bool IsObjectiveInProgress(const FGameplayTag& objectiveTag) const;
+    FORCEINLINE bool IsObjectiveInProgress(const FGameplayTag& objectiveTag) const
+    {
+        return inProgressObjectives.Contains(objectiveTag);
+    }
 
     UFUNCTION(BlueprintCallable, Category = AQS)
     class UAQSQuest* GetQuestFromDB(const FGameplayTag& questTag);
 
+    /*Returns the runtime instance of an in progress or ended quest. Ended quests only keep
+    a record, their instance is rebuilt from the template the first time it is requested*/
     UFUNCTION(BlueprintCallable, Category = AQS)
-    class UAQSQuest* GetQuest(const FGameplayTag& questTag) const;
+    class UAQSQuest* GetQuest(const FGameplayTag& questTag);
+
+    /*Returns the template of the provided quest from the indexed Quests Database.
+    It is shared by every player, use it only to read quest data*/
+    const UAQSQuest* GetQuestTemplate(const FGameplayTag& questTag) const;
 
     UFUNCTION(BlueprintCallable, Category = AQS)
-    class UAQSQuestObjective* GetQuestObjectiveFromDB(const FGameplayTag& objectiveTag, const FGameplayTag& questTag) const;
+    class UAQSQuestObjective* GetQuestObjectiveFromDB(const FGameplayTag& objectiveTag, const FGameplayTag& questTag);
+
+    /*Tries to get the record of a completed or failed quest, with the objectives it completed*/
+    UFUNCTION(BlueprintCallable, Category = AQS)
+    bool TryGetEndedQuestRecord(const FGameplayTag& questTag, FAQSQuestRecord& outRecord) const;
 
     /*Tries to get the objective info for the provided objective, works on both client and server*/
     UFUNCTION(BlueprintCallable, Category = AQS)
@@ -285,8 +308,13 @@ public:
 
     void UnregisterTarget(class UAQSQuestTargetComponent* targetComp);
 
+    /*Queues the update, all the updates of a frame are broadcasted together on the next tick*/
     void DispatchObjectiveUpdate(const FGameplayTag& objectiveTag, const FGameplayTag& questTag, EQuestUpdateType updateType);
 
+    void RegisterObjectiveListener(const FGameplayTag& objectiveTag, UAQSQuest* quest);
+
+    void UnregisterObjectiveListener(const FGameplayTag& objectiveTag, UAQSQuest* quest);
+
     UFUNCTION(Client, Reliable, Category = AQS)
     void ClientDispatchObjectiveUpdate(const FGameplayTag& objectiveTag, const FGameplayTag& questTag, EQuestUpdateType updateType);
 
@@ -323,11 +351,9 @@ public:
 private:
     bool Internal_StartQuest(UAQSQuest* questToStart, const bool bStartChildNodes, bool autoTrack = true);
 
+    /*Completed and failed quests, only their completed objectives are kept*/
     UPROPERTY()
-    TArray<class UAQSQuest*> CompletedQuests;
-
-    UPROPERTY()
-    TArray<class UAQSQuest*> FailedQuests;
+    TMap<FGameplayTag, FAQSQuestRecord> endedQuestsRecords;
 
     UPROPERTY()
     TArray<class UAQSQuest*> InProgressQuests;
@@ -335,15 +361,20 @@ private:
     UPROPERTY()
     class UAQSQuest* TrackedQuest;
 
+    /*Tags are replicated by net index, appending a quest only sends the new entry*/
     UPROPERTY(SaveGame, ReplicatedUsing = OnRep_CompletedQuestsTags)
     TArray<FGameplayTag> CompletedQuestsTags;
 
     UPROPERTY(SaveGame, ReplicatedUsing = OnRep_FailedQuestsTags)
     TArray<FGameplayTag> FailedQuestsTags;
 
-    UPROPERTY(SaveGame, ReplicatedUsing = OnRep_InProgressQuestsRecords)
+    /*Authoritative on server, rebuilt from InProgressQuestsProgress on clients*/
+    UPROPERTY(SaveGame)
     TArray<FAQSQuestRecord> InProgressQuestsRecords;
 
+    UPROPERTY(Replicated)
+    FAQSQuestProgressArray InProgressQuestsProgress;
+
     UPROPERTY(SaveGame, ReplicatedUsing = OnRep_TrackedQuest)
     FGameplayTag TrackedQuestTag;
 
@@ -351,13 +382,23 @@ private:
     void OnRep_TrackedQuest();
 
     UFUNCTION()
-    void OnRep_InProgressQuestsRecords();
+    void OnRep_FailedQuestsTags(const TArray<FGameplayTag>& previousTags);
 
     UFUNCTION()
-    void OnRep_FailedQuestsTags();
+    void OnRep_CompletedQuestsTags(const TArray<FGameplayTag>& previousTags);
 
-    UFUNCTION()
-    void OnRep_CompletedQuestsTags();
+    void HandleQuestProgressReplicated(const TSet<FGameplayTag>& changedQuests);
+
+    /*Records the newly ended quests, returns false if a full sync is required*/
+    bool ApplyEndedQuests(const TArray<FGameplayTag>& previousTags, const TArray<FGameplayTag>& endedTags);
+
+    /*Stores the completed objectives of the ended quest, before its instance is released*/
+    void AddEndedQuestRecord(const FGameplayTag& questTag);
+
+    UAQSQuest* InstanceEndedQuest(const FGameplayTag& questTag);
+
+    /*Runtime instance of the quest if it is loaded, never creates one*/
+    UAQSQuest* FindLoadedQuest(const FGameplayTag& questTag) const;
 
     TMultiMap<FGameplayTag, UAQSQuestTargetComponent*> QuestTargets;
 
@@ -375,6 +416,36 @@ private:
 
     void SyncGraphs();
 
+    void SyncQuestGraph(const FAQSQuestRecord& questData);
+
+    UAQSQuestSubsystem* GetQuestSubsystem() const;
+
+    void ReleaseQuestInstance(const FGameplayTag& questTag);
+
+    void UnregisterQuestListeners(UAQSQuest* quest);
+
+    void AddInProgressRecord(const FAQSQuestRecord& record);
+
+    void RemoveInProgressRecord(const FGameplayTag& questTag);
+
+    void UpdateInProgressRecord(const FAQSQuestRecord& record);
+
+    void CountRecordObjectives(const FAQSQuestRecord& record, int32 delta);
+
+    void RebuildInProgressObjectives();
+
+    void FlushObjectiveUpdates();
+
+    /*In progress quests listening to each active objective, in activation order*/
+    TMap<FGameplayTag, TArray<UAQSQuest*>> objectiveListeners;
+
+    /*How many in progress records reference each objective, works on both client and server*/
+    TMap<FGameplayTag, int32> inProgressObjectives;
+
+    TArray<FAQSPendingObjectiveUpdate> pendingObjectiveUpdates;
+
+    bool bObjectiveUpdatesFlushPending = false;
+
     UPROPERTY()
     TMap<FGameplayTag, UAQSQuest*> loadedQuests;
 };
\ No newline at end of file
@@ -0,0 +1,52 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include <GameplayTagContainer.h>
+
+#include "AQSQuestSubsystem.generated.h"
+
+class UAQSQuest;
+class UDataTable;
+
+/*Quest templates of a single quests database, indexed by quest tag*/
+USTRUCT()
+struct FAQSQuestsDBIndex {
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    TMap<FGameplayTag, TObjectPtr<UAQSQuest>> Templates;
+};
+
+/**
+ * Indexes the quests databases once so that quest managers can resolve
+ * a quest template by tag without walking the table rows
+ */
+UCLASS()
+class ASCENTQUESTSYSTEM_API UAQSQuestSubsystem : public UGameInstanceSubsystem {
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    /*Returns the shared template of the provided quest. Templates must never
+    be started, use them only to read quest data*/
+    const UAQSQuest* GetQuestTemplate(const UDataTable* questsDB, const FGameplayTag& questTag);
+
+    /*Builds the index of the provided database if it wasn't built yet*/
+    UFUNCTION(BlueprintCallable, Category = AQS)
+    void IndexQuestsDB(const UDataTable* questsDB);
+
+    /*Drops the index of the provided database, it will be rebuilt on the next lookup*/
+    UFUNCTION(BlueprintCallable, Category = AQS)
+    void InvalidateQuestsDB(const UDataTable* questsDB);
+
+private:
+    const FAQSQuestsDBIndex* FindOrBuildIndex(const UDataTable* questsDB);
+
+    UPROPERTY()
+    TMap<TObjectPtr<UDataTable>, FAQSQuestsDBIndex> indexedDBs;
+};
@@ -6,11 +6,13 @@
 #include "CoreMinimal.h"
 #include "Engine/DataTable.h"
 #include "Graph/AQSQuest.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "UObject/NoExportTypes.h"
 
 #include "AQSTypes.generated.h"
 
 class UAQSQuest;
+class UAQSQuestManagerComponent;
 
 /**
  *
@@ -112,6 +114,86 @@ public:
     }
 };
 
+/*A replicated progress entry of an in progress quest. The entry with no objective
+marks the quest itself, the others are its active and completed objectives*/
+USTRUCT()
+struct FAQSQuestProgressItem : public FFastArraySerializerItem {
+    GENERATED_BODY()
+
+public:
+    FAQSQuestProgressItem()
+    {
+        CurrentRepetitions = 0;
+        bCompleted = false;
+    };
+
+    UPROPERTY()
+    FGameplayTag Quest;
+
+    UPROPERTY()
+    FGameplayTag Objective;
+
+    UPROPERTY()
+    int32 CurrentRepetitions;
+
+    UPROPERTY()
+    bool bCompleted;
+};
+
+/*Progress of the in progress quests, replicated as a fast array so that a single
+objective update only sends the changed entry*/
+USTRUCT()
+struct FAQSQuestProgressArray : public FFastArraySerializer {
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    TArray<FAQSQuestProgressItem> Items;
+
+    /*SERVER: adds the provided record or updates the entries of the existing one*/
+    void SetQuestRecord(const FAQSQuestRecord& record);
+
+    /*SERVER: removes all the entries of the provided quest*/
+    void RemoveQuest(const FGameplayTag& questTag);
+
+    /*SERVER: replaces all the entries with the provided records*/
+    void Rebuild(const TArray<FAQSQuestRecord>& records);
+
+    /*Rebuilds the record of the provided quest, returns false if the quest is not in progress*/
+    bool BuildQuestRecord(const FGameplayTag& questTag, FAQSQuestRecord& outRecord) const;
+
+    void SetOwner(UAQSQuestManagerComponent* inOwner)
+    {
+        owner = inOwner;
+    }
+
+    // FAST ARRAY CALLBACKS//
+    void PreReplicatedRemove(const TArrayView<int32>& removedIndices, int32 finalSize);
+
+    void PostReplicatedAdd(const TArrayView<int32>& addedIndices, int32 finalSize);
+
+    void PostReplicatedChange(const TArrayView<int32>& changedIndices, int32 finalSize);
+
+    void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& parameters);
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& deltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FAQSQuestProgressItem, FAQSQuestProgressArray>(Items, deltaParms, *this);
+    }
+
+private:
+    UAQSQuestManagerComponent* owner = nullptr;
+
+    TSet<FGameplayTag> changedQuests;
+};
+
+template <>
+struct TStructOpsTypeTraits<FAQSQuestProgressArray> : public TStructOpsTypeTraitsBase2<FAQSQuestProgressArray> {
+    enum {
+        WithNetDeltaSerializer = true,
+    };
+};
+
 USTRUCT(BlueprintType)
 struct FAQSObjectiveInfo {
     GENERATED_BODY()
@@ -85,6 +85,9 @@ public:
     UFUNCTION(BlueprintPure, Category = AQS)
     FGameplayTag GetObjectiveTag() const;
 
+    /** Objectives are indexed by their tag in the quest graph */
+    virtual FGameplayTag GetNodeTag() const override;
+
     UFUNCTION(BlueprintPure, Category = AQS)
     FORCEINLINE bool IsObjectiveCompleted() const
     {
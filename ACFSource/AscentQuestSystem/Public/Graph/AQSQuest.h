@@ -43,6 +43,8 @@ private:
 protected:
     virtual bool ActivateNode(class UAGSGraphNode* node) override;
 
+    virtual bool DeactivateNode(class UAGSGraphNode* node) override;
+
     /*Unique Tag for this quest, is a good practice to use a root GameplayTag for this, and
     child tags for objectives*/
     UPROPERTY(EditDefaultsOnly, Category = AQS)
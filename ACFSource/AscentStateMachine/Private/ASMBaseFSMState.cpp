@@ -40,6 +40,11 @@ void UASMBaseFSMState::OnUpdate_Implementation(float deltaTime)
 
 }
 
+bool UASMBaseFSMState::ImplementsTick() const
+{
+	return GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UASMBaseFSMState, OnUpdate));
+}
+
 void UASMBaseFSMState::OnTransition_Implementation(const UASMBaseFSMState* previousState)
 {
 
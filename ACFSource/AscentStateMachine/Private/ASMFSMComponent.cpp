@@ -3,6 +3,7 @@
 #include "ASMFSMComponent.h"
 #include "ASMBaseFSMState.h"
 #include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
 
 // Sets default values for this component's properties
 UASMFSMComponent::UASMFSMComponent()
@@ -10,6 +11,8 @@ UASMFSMComponent::UASMFSMComponent()
     // Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
     // off to improve performance if you don't need them.
     PrimaryComponentTick.bCanEverTick = true;
+    // Only ticks while the current state has update logic, see UpdateTickState
+    PrimaryComponentTick.bStartWithTickEnabled = false;
     SetIsReplicatedByDefault(true);
 }
 
@@ -27,8 +30,12 @@ void UASMFSMComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
     Super::EndPlay(EndPlayReason);
 
     if (StateMachine) {
+        StateMachine->OnStateChanged.RemoveAll(this);
         StateMachine->StopFSM();
     }
+    if (UWorld* world = GetWorld()) {
+        world->GetTimerManager().ClearAllTimersForObject(this);
+    }
 }
 
 // void UASMFSMComponent::GetLifetimeReplicatedProps(TArray< FLifetimeProperty >& OutLifetimeProps) const
@@ -43,24 +50,36 @@ void UASMFSMComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 
     if (StateMachine && StateMachine->IsActive()) {
         StateMachine->DispatchTick(DeltaTime);
-        if (pendingTransition != FGameplayTag()) {
-            StateMachine->TriggerTransition(pendingTransition);
-            pendingTransition = FGameplayTag();
-        }
+        FlushPendingTransition();
     }
 }
 
-void UASMFSMComponent::PostInitProperties()
+void UASMFSMComponent::UpdateTickState()
 {
-    Super::PostInitProperties();
+    const bool bShouldTick = StateMachine && StateMachine->IsCurrentStateTicking();
+    if (bShouldTick) {
+        const UASMBaseFSMState* currentState = StateMachine->GetCurrentState();
+        SetComponentTickInterval(currentState ? currentState->GetTickInterval() : 0.f);
+    }
+    SetComponentTickEnabled(bShouldTick);
+}
 
-    SetComponentTickEnabled(true);
+void UASMFSMComponent::FlushPendingTransition()
+{
+    if (StateMachine && StateMachine->IsActive() && pendingTransition != FGameplayTag()) {
+        const FGameplayTag transition = pendingTransition;
+        pendingTransition = FGameplayTag();
+        StateMachine->TriggerTransition(transition);
+    }
 }
 
 void UASMFSMComponent::StartFSM()
 {
     if (StateMachine) {
+        StateMachine->OnStateChanged.RemoveAll(this);
+        StateMachine->OnStateChanged.AddUObject(this, &UASMFSMComponent::UpdateTickState);
         StateMachine->StartFSM(GetOwner(), bShouldDisplayDebugInfo);
+        UpdateTickState();
     } else {
         UE_LOG(LogTemp, Error, TEXT("Invalid State Machine - UASMFSMComponent::StartFSM"));
     }
@@ -78,6 +97,12 @@ void UASMFSMComponent::StopFSM()
 void UASMFSMComponent::TriggerTransition(const FGameplayTag& transition)
 {
     pendingTransition = transition;
+
+    // without a ticking state nothing would consume the transition, apply it on the next frame
+    UWorld* world = GetWorld();
+    if (!IsComponentTickEnabled() && world) {
+        world->GetTimerManager().SetTimerForNextTick(this, &UASMFSMComponent::FlushPendingTransition);
+    }
 }
 
 void UASMFSMComponent::ClientTriggerTransition_Implementation(const FGameplayTag& transition)
@@ -12,6 +12,11 @@ bool UASMNestedFSMState::TriggerSubFSMTransition(const FGameplayTag& transition)
 	return false;
 }
 
+bool UASMNestedFSMState::ImplementsTick() const
+{
+	return (bCanFsmTick && SubFSM) || Super::ImplementsTick();
+}
+
 void UASMNestedFSMState::OnEnter_Implementation()
 {
 	if (SubFSM) {
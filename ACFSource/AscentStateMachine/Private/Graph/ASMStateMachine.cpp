@@ -11,7 +11,41 @@ bool UASMStateMachine::ActivateNode(class UAGSGraphNode* node)
 {
     currentState = Cast<UASMStateNode>(node);
 
-    return Super::ActivateNode(node);
+    const bool bActivated = Super::ActivateNode(node);
+    // OnEnter may already have moved to another state, which notified on its own
+    if (currentState == node) {
+        OnStateChanged.Broadcast();
+    }
+    return bActivated;
+}
+
+void UASMStateMachine::CompileGraph()
+{
+    Super::CompileGraph();
+    CacheTickingStates();
+}
+
+void UASMStateMachine::PostLoad()
+{
+    Super::PostLoad();
+    CacheTickingStates();
+}
+
+void UASMStateMachine::CacheTickingStates()
+{
+    bHasTickingStates = false;
+    for (UAGSGraphNode* node : AllNodes) {
+        UASMStateNode* stateNode = Cast<UASMStateNode>(node);
+        if (stateNode) {
+            stateNode->CacheTickRequirements();
+            bHasTickingStates |= stateNode->ImplementsTick();
+        }
+    }
+}
+
+bool UASMStateMachine::IsCurrentStateTicking() const
+{
+    return IsActive() && currentState && currentState->ImplementsTick();
 }
 
 void UASMStateMachine::DispatchTick(float DeltaTime)
@@ -97,6 +131,7 @@ void UASMStateMachine::StopFSM()
             DeactivateNode(node);
         }
         Enabled = EFSMState::NotStarted;
+        OnStateChanged.Broadcast();
     } else {
         UE_LOG(LogTemp, Error, TEXT("FSM Not Started - UASMStateMachine::StopFSM"));
     }
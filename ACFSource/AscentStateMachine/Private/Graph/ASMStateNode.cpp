@@ -6,6 +6,7 @@
 #include "ASMBaseFSMState.h"
 #include "Graph/ASMStateMachine.h"
 #include "Math/Color.h"
+#include "TimerManager.h"
 
 
 void UASMStateNode::ActivateNode()
@@ -15,6 +16,15 @@ void UASMStateNode::ActivateNode()
 		APlayerController* control = UGameplayStatics::GetPlayerController(this, 0);
 		State->Internal_OnEnter(control,
 			Cast<UASMStateMachine>(GetGraph()));
+
+		// timed transitions run on a timer, so that states without update logic don't need to tick.
+		// OnEnter may already have moved the FSM to another state
+		const UASMStateMachine* fsm = Cast<UASMStateMachine>(GetGraph());
+		UWorld* world = fsm ? fsm->GetWorld() : nullptr;
+		if (world && State->TimedTransition.IsValid() && fsm->GetCurrentState() == State) {
+			world->GetTimerManager().SetTimer(timedTransitionHandle, this, &UASMStateNode::HandleTimedTransition,
+				FMath::Max(State->TimedTransitionDelay, KINDA_SMALL_NUMBER), false);
+		}
 	}
 	else {
 		UE_LOG(LogTemp, Error, TEXT("Invalid State - UASMStateNode::ActivateNode "));
@@ -24,6 +34,10 @@ void UASMStateNode::ActivateNode()
 void UASMStateNode::DeactivateNode()
 {
 	Super::DeactivateNode();
+	UWorld* world = GetGraph() ? GetGraph()->GetWorld() : nullptr;
+	if (world) {
+		world->GetTimerManager().ClearTimer(timedTransitionHandle);
+	}
 	if (State) {
 		State->Internal_OnExit();
 	}
@@ -42,6 +56,18 @@ void UASMStateNode::OnTransition(const UASMBaseFSMState* previousState)
 	}
 }
 
+void UASMStateNode::CacheTickRequirements()
+{
+	bStateImplementsTick = State && State->ImplementsTick();
+}
+
+void UASMStateNode::HandleTimedTransition()
+{
+	if (State) {
+		State->TriggerTransition(State->TimedTransition);
+	}
+}
+
 UASMStateNode::UASMStateNode()
 {
 #if WITH_EDITOR
@@ -37,7 +37,27 @@ public:
         return actorOwner;
     }
 
+    /*Whether OnUpdate has to be called while this state is active, evaluated when the FSM is compiled.
+    Native states overriding OnUpdate_Implementation must override this as well*/
+    virtual bool ImplementsTick() const;
+
+    float GetTickInterval() const
+    {
+        return TickInterval;
+    }
+
 protected:
+    /*Seconds between two OnUpdate calls while this state is active, 0 to update every frame*/
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = ASM, meta = (ClampMin = 0.f))
+    float TickInterval = 0.f;
+
+    /*If set, this transition is triggered TimedTransitionDelay seconds after entering the state, no tick required*/
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = ASM)
+    FGameplayTag TimedTransition;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = ASM, meta = (ClampMin = 0.f))
+    float TimedTransitionDelay = 1.f;
+
     UPROPERTY(BlueprintReadOnly, Category = ASM)
     class APlayerController* LocalController;
 
@@ -38,7 +38,6 @@ protected:
 
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
-	virtual void PostInitProperties() override;
 public:	
 
 	/*Starts the actual FSM calling OnEnter on the StartNode State*/
@@ -107,6 +106,11 @@ private:
 
 	FGameplayTag pendingTransition;
 
+	/*Enables the component tick only while the current state has update logic, with its tick interval*/
+	void UpdateTickState();
+
+	void FlushPendingTransition();
+
 
 /*	TObjectPtr<UASMStateMachine> FSM;*/
 };
@@ -6,6 +6,8 @@
 #include "AGSGraph.h"
 #include "ASMStateMachine.generated.h"
 
+DECLARE_MULTICAST_DELEGATE(FOnFSMStateChanged);
+
 /**
  * 
  */
@@ -36,6 +38,11 @@ private:
 
 	bool bPrintDebug = false;
 
+	bool bHasTickingStates = false;
+
+	/*Caches which states have update logic, state classes can change without the FSM being saved so this runs on every load*/
+	void CacheTickingStates();
+
 protected:
 
 	virtual bool ActivateNode(class UAGSGraphNode* node) override;
@@ -65,6 +72,21 @@ public:
 
 	void DispatchTick(float DeltaTime);
 
+	virtual void CompileGraph() override;
+
+	virtual void PostLoad() override;
+
+	/*Whether at least one state of this FSM has update logic*/
+	bool HasTickingStates() const {
+		return bHasTickingStates;
+	}
+
+	/*Whether the current state has update logic and needs DispatchTick*/
+	bool IsCurrentStateTicking() const;
+
+	/*Called whenever the FSM enters a new state or stops, every component running this asset listens to it*/
+	FOnFSMStateChanged OnStateChanged;
+
 	UWorld* GetWorld() const override { return fsmOwner ? fsmOwner->GetWorld() : nullptr; }
 
 };
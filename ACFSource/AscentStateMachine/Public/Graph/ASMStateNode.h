@@ -50,6 +50,14 @@ public:
         return State;
     }
 
+    /*Whether the state of this node has update logic, cached when the FSM is compiled*/
+    bool ImplementsTick() const
+    {
+        return bStateImplementsTick;
+    }
+
+    void CacheTickRequirements();
+
     UASMStateNode();
 
 protected:
@@ -58,4 +66,11 @@ protected:
 
     UPROPERTY(EditDefaultsOnly, Instanced, Category = ASM)
     class UASMBaseFSMState* State;
+
+private:
+    bool bStateImplementsTick = false;
+
+    FTimerHandle timedTransitionHandle;
+
+    void HandleTimedTransition();
 };
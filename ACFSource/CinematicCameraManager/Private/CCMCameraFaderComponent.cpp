@@ -6,7 +6,7 @@
 #include "Camera/CameraComponent.h"
 #include "Engine/World.h"
 #include "GameFramework/SpringArmComponent.h"
-#include "Kismet/KismetSystemLibrary.h"
+#include "DrawDebugHelpers.h"
 #include <GameFramework/Actor.h>
 #include <GameFramework/Pawn.h>
 #include <GameFramework/PlayerController.h>
@@ -20,7 +20,7 @@ UCCMCameraFaderComponent::UCCMCameraFaderComponent()
     // off to improve performance if you don't need them.
     PrimaryComponentTick.bCanEverTick = true;
     FadeableComponentClass = UCCMFadeableActorComponent::StaticClass();
-    // ...
+    occlusionTraceDelegate.BindUObject(this, &UCCMCameraFaderComponent::HandleOcclusionTraceDone);
 }
 
 void UCCMCameraFaderComponent::AddActorToIgnore(AActor* newActor)
@@ -48,6 +48,7 @@ void UCCMCameraFaderComponent::BeginPlay()
         HandlePawnChanges(newPawn);
     });
     HandlePawnChanges(nullptr);
+    SetComponentTickInterval(OcclusionCheckInterval);
 }
 
 // Called every frame
@@ -79,51 +80,89 @@ void UCCMCameraFaderComponent::CheckOcclusion()
         return;
     }
 
-    if (ActiveCamera && ActiveController && ActiveController->GetPawn()) {
+    UWorld* world = GetWorld();
+    if (world && ActiveCamera && ActiveController && ActiveController->GetPawn()) {
         const FVector Start = ActiveCamera->GetComponentLocation();
         const FVector End = ActiveController->GetPawn()->GetActorLocation();
         APawn* activePawn = ActiveController->GetPawn();
 
-        TArray<AActor*> ActorsToIgnore;
-        TArray<FHitResult> OutHits;
-        // The list of actors hit by the line trace, that means that they are occluded from view
-        TSet<const AActor*> newActors;
-
-        ActorsToIgnore.Append(IgnoredActors);
-        ActorsToIgnore.Add(activePawn);
-        const EDrawDebugTrace::Type ShouldDebug = bShowDebug ? EDrawDebugTrace::ForDuration : EDrawDebugTrace::None;
-
-        const bool bGotHits = UKismetSystemLibrary::LineTraceMultiForObjects(GetWorld(), Start, End, CollisionObjectTypes, true,
-            ActorsToIgnore, ShouldDebug, OutHits, true, FLinearColor::Blue, FLinearColor::Green, 0.f);
-        
-        if (activePawn && bFadePlayer && !bPlayerOccluded && FMath::Abs((Start - activePawn->GetActorLocation()).Size()) < MaxPlayerFadeDistance) {
-            HideActor(activePawn);
-            bPlayerOccluded = true; 
-        } else if (bFadePlayer && bPlayerOccluded && FMath::Abs((Start - activePawn->GetActorLocation()).Size()) > MaxPlayerFadeDistance) {
-            ShowActor(activePawn);
-            bPlayerOccluded = false; 
+        UpdatePlayerFade(Start, activePawn);
+
+        // the previous trace has not come back yet
+        if (bOcclusionTracePending) {
+            return;
+        }
+
+        FCollisionObjectQueryParams objectParams;
+        for (const TEnumAsByte<EObjectTypeQuery>& objectType : CollisionObjectTypes) {
+            objectParams.AddObjectTypesToQuery(UEngineTypes::ConvertToCollisionChannel(objectType));
+        }
+        if (!objectParams.IsValid()) {
+            return;
+        }
+
+        FCollisionQueryParams queryParams(SCENE_QUERY_STAT(CCMCameraOcclusion), true);
+        queryParams.AddIgnoredActors(IgnoredActors);
+        queryParams.AddIgnoredActor(activePawn);
+
+        if (bShowDebug) {
+            DrawDebugLine(world, Start, End, FColor::Blue, false, OcclusionCheckInterval);
         }
-        if (bGotHits) {
-
-            // Hide actors that are occluded by the camera
-            for (const FHitResult& hit : OutHits) {
-                AActor* hitActor = Cast<AActor>(hit.GetActor());
-                if (FMath::Abs((Start - hit.Location).Size()) < MaxOccludingDistance) {
-                    newActors.Add(hitActor);
-                    if (hitActor && CanOccludeActor(hitActor) && !OccludedActors.Contains(hitActor)) {
-                        HideOccludedActor(hitActor);
-                    }
-                }
+
+        bOcclusionTracePending = true;
+        world->AsyncLineTraceByObjectType(EAsyncTraceType::Multi, Start, End, objectParams, queryParams, &occlusionTraceDelegate);
+    }
+}
+
+void UCCMCameraFaderComponent::UpdatePlayerFade(const FVector& cameraLocation, APawn* activePawn)
+{
+    if (!bFadePlayer) {
+        return;
+    }
+
+    const float playerDistance = (cameraLocation - activePawn->GetActorLocation()).Size();
+    if (!bPlayerOccluded && playerDistance < MaxPlayerFadeDistance) {
+        HideActor(activePawn);
+        bPlayerOccluded = true;
+    } else if (bPlayerOccluded && playerDistance > MaxPlayerFadeDistance + PlayerFadeHysteresisDistance) {
+        ShowActor(activePawn);
+        bPlayerOccluded = false;
+    }
+}
+
+void UCCMCameraFaderComponent::HandleOcclusionTraceDone(const FTraceHandle& traceHandle, FTraceDatum& traceDatum)
+{
+    bOcclusionTracePending = false;
+    if (!GetOcclusionEnabled()) {
+        ForceShowOccludedActors();
+        return;
+    }
+
+    const double now = GetWorld()->GetTimeSeconds();
+
+    // Hide actors that are occluded by the camera, only the new ones swap their materials
+    for (const FHitResult& hit : traceDatum.OutHits) {
+        AActor* hitActor = hit.GetActor();
+        if (hitActor && (traceDatum.Start - hit.Location).Size() < MaxOccludingDistance) {
+            if (OccludedActors.Contains(hitActor)) {
+                lastOccludedTimes.Add(hitActor, now);
+            } else if (CanOccludeActor(hitActor) && HideOccludedActor(hitActor)) {
+                lastOccludedTimes.Add(hitActor, now);
             }
+        }
+    }
 
-            // Show actors that are currently hidden but that are not occluded by the camera anymore
-            for (auto& Elem : GetOccludedActors()) {
-                if (!newActors.Contains(Elem) && Elem) {
-                    ShowOccludedActor(Elem);
-                }
+    // Show actors that have not been occluded for long enough
+    for (int32 index = OccludedActors.Num() - 1; index >= 0; --index) {
+        AActor* occludedActor = OccludedActors[index];
+        const double* lastOccluded = lastOccludedTimes.Find(occludedActor);
+        if (!lastOccluded || now - *lastOccluded >= OcclusionHysteresisTime) {
+            lastOccludedTimes.Remove(occludedActor);
+            if (occludedActor) {
+                ShowOccludedActor(occludedActor);
+            } else {
+                OccludedActors.RemoveAt(index);
             }
-        } else {
-            ForceShowOccludedActors();
         }
     }
 }
@@ -151,13 +190,14 @@ bool UCCMCameraFaderComponent::HideActor(AActor* Actor)
             return false;
         }
         newComp->RegisterComponent();
+        fadeComp = newComp;
     }
 
     if (!fadeComp) {
         return false;
     }
 
-    fadeComp->SetMaterialOverride(FadeMaterial);
+    fadeComp->FadeOut(FadeMaterial);
     return true;
 }
 
@@ -175,7 +215,7 @@ void UCCMCameraFaderComponent::ShowActor(AActor* Actor)
 {
     UCCMFadeableActorComponent* fadeComp = Actor->FindComponentByClass<UCCMFadeableActorComponent>();
     if (fadeComp) {
-        fadeComp->RestoreMaterials();
+        fadeComp->FadeIn();
         return;
     }
 }
@@ -184,13 +224,14 @@ void UCCMCameraFaderComponent::ForceShowOccludedActors()
 {
     if (!OccludedActors.IsEmpty()) {
         for (auto& actor : OccludedActors) {
-            UCCMFadeableActorComponent* fadeComp = actor->FindComponentByClass<UCCMFadeableActorComponent>();
+            UCCMFadeableActorComponent* fadeComp = actor ? actor->FindComponentByClass<UCCMFadeableActorComponent>() : nullptr;
             if (fadeComp) {
-                fadeComp->RestoreMaterials();
+                fadeComp->FadeIn();
             }
         }
         OccludedActors.Empty();
     }
+    lastOccludedTimes.Empty();
 }
 
 bool UCCMCameraFaderComponent::CanOccludeActor(const AActor* Actor) const
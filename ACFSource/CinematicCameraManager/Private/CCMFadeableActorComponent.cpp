@@ -3,15 +3,15 @@
 #include "CCMFadeableActorComponent.h"
 #include "CCMTypes.h"
 #include "Components/MeshComponent.h"
+#include "Curves/CurveFloat.h"
 
 // Sets default values for this component's properties
 UCCMFadeableActorComponent::UCCMFadeableActorComponent()
 {
     // Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
     // off to improve performance if you don't need them.
-    PrimaryComponentTick.bCanEverTick = false;
-
-    // ...
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
 }
 
 void UCCMFadeableActorComponent::SetMaterialOverride(UMaterialInterface* newMaterial)
@@ -98,3 +98,59 @@ void UCCMFadeableActorComponent::GatherMaterials()
         }
     }
 }
+
+void UCCMFadeableActorComponent::FadeOut(UMaterialInterface* fadeMaterial)
+{
+    if (FadeMode == ECCMFadeMode::EMaterialSwap) {
+        SetMaterialOverride(fadeMaterial);
+        return;
+    }
+
+    if (fadeMeshes.IsEmpty()) {
+        TArray<UMeshComponent*> meshes;
+        GetOwner()->GetComponents<UMeshComponent>(meshes);
+        fadeMeshes.Append(meshes);
+    }
+    targetFade = 1.f;
+    SetComponentTickEnabled(true);
+}
+
+void UCCMFadeableActorComponent::FadeIn()
+{
+    if (FadeMode == ECCMFadeMode::EMaterialSwap) {
+        RestoreMaterials();
+        return;
+    }
+
+    targetFade = 0.f;
+    SetComponentTickEnabled(currentFade != targetFade);
+}
+
+void UCCMFadeableActorComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (FadeDuration > 0.f) {
+        currentFade = FMath::FInterpConstantTo(currentFade, targetFade, DeltaTime, 1.f / FadeDuration);
+    } else {
+        currentFade = targetFade;
+    }
+    ApplyFadeOpacity();
+
+    if (currentFade == targetFade) {
+        SetComponentTickEnabled(false);
+    }
+}
+
+void UCCMFadeableActorComponent::ApplyFadeOpacity()
+{
+    const float fadeAlpha = FadeCurve ? FadeCurve->GetFloatValue(currentFade) : currentFade;
+    const float opacity = FMath::Lerp(1.f, FadedOpacity, fadeAlpha);
+
+    // only updates the primitive data on the render thread, materials and render state are untouched
+    for (UMeshComponent* meshComp : fadeMeshes) {
+        if (meshComp) {
+            meshComp->SetCustomPrimitiveDataFloat(FadePrimitiveDataIndex, opacity);
+        }
+    }
+}
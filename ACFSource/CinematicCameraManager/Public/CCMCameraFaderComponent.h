@@ -5,6 +5,7 @@
 #include "CCMTypes.h"
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
+#include "WorldCollision.h"
 #include <GameFramework/Actor.h>
 
 #include "CCMCameraFaderComponent.generated.h"
@@ -55,6 +56,14 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = CCM)
     bool bOcclusionEnabled;
 
+    /*Seconds between two occlusion checks, traces are async and their results are applied the next frame*/
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = CCM, meta = (ClampMin = 0.f))
+    float OcclusionCheckInterval = 0.1f;
+
+    /*Seconds an actor has to stay out of the trace before being shown again, avoids flickering on edges*/
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = CCM, meta = (ClampMin = 0.f))
+    float OcclusionHysteresisTime = 0.3f;
+
     /*Max distance of occluding actor from the camera*/
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = CCM)
     float MaxOccludingDistance = 280.f;
@@ -67,6 +76,10 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = CCM)
     float MaxPlayerFadeDistance = 70.f;
 
+    /*Extra distance the camera has to move away before the player is shown again*/
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = CCM, meta = (ClampMin = 0.f))
+    float PlayerFadeHysteresisDistance = 10.f;
+
     /*Collisions channels to check for occluders*/
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = CCM)
     TArray<TEnumAsByte<EObjectTypeQuery>> CollisionObjectTypes;
@@ -106,6 +119,18 @@ private:
     UFUNCTION()
     void CheckOcclusion();
 
+    void HandleOcclusionTraceDone(const FTraceHandle& traceHandle, FTraceDatum& traceDatum);
+
+    void UpdatePlayerFade(const FVector& cameraLocation, APawn* activePawn);
+
+    FTraceDelegate occlusionTraceDelegate;
+
+    /*True while an occlusion trace is in flight, no new trace is started until it completes*/
+    bool bOcclusionTracePending = false;
+
+    /*Last time each occluded actor was found by the trace*/
+    TMap<TWeakObjectPtr<AActor>, double> lastOccludedTimes;
+
     bool HideOccludedActor(AActor* Actor);
     void ShowOccludedActor(AActor* OccludedActor);
 
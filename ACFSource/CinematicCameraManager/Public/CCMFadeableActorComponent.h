@@ -8,7 +8,9 @@
 
 #include "CCMFadeableActorComponent.generated.h"
 
+class UCurveFloat;
 class UMaterialInterface;
+class UMeshComponent;
 
 UCLASS(ClassGroup = (CCM), meta = (BlueprintSpawnableComponent))
 class CINEMATICCAMERAMANAGER_API UCCMFadeableActorComponent : public UActorComponent {
@@ -41,6 +43,31 @@ public:
     UFUNCTION(BlueprintCallable, Category = CCM)
     void RestoreMaterials();
 
+    /*Fades the actor out, by swapping its materials with fadeMaterial or by driving its opacity primitive data depending on FadeMode*/
+    UFUNCTION(BlueprintCallable, Category = CCM)
+    void FadeOut(UMaterialInterface* fadeMaterial);
+
+    /*Fades the actor back in*/
+    UFUNCTION(BlueprintCallable, Category = CCM)
+    void FadeIn();
+
+    /*Sets the curve used by this actor to blend its opacity while fading*/
+    UFUNCTION(BlueprintCallable, Category = CCM)
+    void SetFadeCurve(UCurveFloat* newCurve)
+    {
+        FadeCurve = newCurve;
+    }
+
+    /*Current fade progress, 0 when fully visible and 1 when fully faded*/
+    UFUNCTION(BlueprintPure, Category = CCM)
+    float GetCurrentFade() const
+    {
+        return currentFade;
+    }
+
+    // Called every frame, only while fading with primitive data
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
 protected:
     // Called when the game starts
     virtual void BeginPlay() override;
@@ -48,9 +75,39 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = CCM)
     TArray<FMeshMaterials> MeshesMaterials;
 
+    /*How the actor is faded. Primitive data keeps the same materials and only changes a float, your materials need to read it
+    as dithered opacity*/
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = CCM)
+    ECCMFadeMode FadeMode = ECCMFadeMode::EMaterialSwap;
+
+    /*Index of the custom primitive data read as opacity by the owner's materials*/
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = CCM, meta = (ClampMin = 0, EditCondition = "FadeMode == ECCMFadeMode::ECustomPrimitiveData"))
+    int32 FadePrimitiveDataIndex = 0;
+
+    /*Opacity of the actor once fully faded*/
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = CCM, meta = (ClampMin = 0.f, ClampMax = 1.f, EditCondition = "FadeMode == ECCMFadeMode::ECustomPrimitiveData"))
+    float FadedOpacity = 0.3f;
+
+    /*Seconds needed to fade out or in*/
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = CCM, meta = (ClampMin = 0.f, EditCondition = "FadeMode == ECCMFadeMode::ECustomPrimitiveData"))
+    float FadeDuration = 0.25f;
+
+    /*Optional, remaps the fade progress (0 to 1) before blending the opacity*/
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = CCM, meta = (EditCondition = "FadeMode == ECCMFadeMode::ECustomPrimitiveData"))
+    TObjectPtr<UCurveFloat> FadeCurve;
+
 private:
     bool bOverriden;
 
+    float currentFade = 0.f;
+
+    float targetFade = 0.f;
+
+    UPROPERTY()
+    TArray<TObjectPtr<UMeshComponent>> fadeMeshes;
+
+    void ApplyFadeOpacity();
+
     TObjectPtr<UMaterialInterface> currentMaterial;
 
     void GatherMaterials();
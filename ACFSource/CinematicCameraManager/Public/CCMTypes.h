@@ -247,3 +247,9 @@ enum class ETargetLockType : uint8 {
     EActor,
     EComponent,
 };
+
+UENUM(BlueprintType)
+enum class ECCMFadeMode : uint8 {
+    EMaterialSwap = 0 UMETA(DisplayName = "Swap Materials"),
+    ECustomPrimitiveData UMETA(DisplayName = "Opacity Primitive Data"),
+};
@@ -28,7 +28,8 @@ public class CollisionsManager : ModuleRules
 				"Core",
 				"Engine",
 				 "Niagara", 
-				 "PhysicsCore"
+				 "PhysicsCore",
+				 "DeveloperSettings"
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -3,6 +3,7 @@
 #include "ACMCollisionManagerComponent.h"
 #include "ACMCollisionsFunctionLibrary.h"
 #include "ACMCollisionsMasterComponent.h"
+#include "ACMDamageQueueSubsystem.h"
 #include "ACMTypes.h"
 #include "Components/ActorComponent.h"
 #include "DrawDebugHelpers.h"
@@ -47,6 +48,13 @@ void UACMCollisionManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayRe
         StopCurrentAreaDamage();
         StopAllTraces();
     }
+
+    // the queue can't reach this component anymore, its damage is applied now
+    UWorld* world = GetWorld();
+    if (UACMDamageQueueSubsystem* damageQueue = world ? world->GetSubsystem<UACMDamageQueueSubsystem>() : nullptr)
+    {
+        damageQueue->FlushSourceDamages(this);
+    }
     Super::EndPlay(EndPlayReason);
 }
 
@@ -296,7 +304,7 @@ void UACMCollisionManagerComponent::PerformAreaDamage_Single_Local(const FVector
             if (!alreadyHitActorsBySphere.Contains(hit.GetActor()))
             {
                 alreadyHitActorsBySphere.Add(hit.GetActor());
-                ApplyDamage(hit, AreaDamageTraceInfo);
+                QueueDamage(hit, AreaDamageTraceInfo);
             }
         }
         if (static_cast<uint8>(ShowDebugInfo) > 0)
@@ -664,21 +672,28 @@ void UACMCollisionManagerComponent::ApplyDamage(const FHitResult& HitResult, con
     }
 }
 
+// Queues damage for the end of the frame, applies it right away if the world has no damage queue.
+void UACMCollisionManagerComponent::QueueDamage(const FHitResult& HitResult, const FBaseTraceInfo& currentTrace)
+{
+    UWorld* world = GetWorld();
+    UACMDamageQueueSubsystem* damageQueue = world ? world->GetSubsystem<UACMDamageQueueSubsystem>() : nullptr;
+    // a source destroyed right after dealing damage (e.g. an exploding projectile) applies it immediately
+    const bool bOwnerBeingDestroyed = !GetOwner() || GetOwner()->IsActorBeingDestroyed();
+    if (damageQueue && !bOwnerBeingDestroyed)
+    {
+        damageQueue->QueueDamage(this, HitResult, currentTrace);
+    } else
+    {
+        ApplyDamage(HitResult, currentTrace);
+    }
+}
+
 // Applies point damage (e.g., sword poke).
 void UACMCollisionManagerComponent::ApplyPointDamage(const FHitResult& HitResult, const FBaseTraceInfo& currentTrace)
 {
     if (IsValid(HitResult.GetActor()))
     {
-        const FVector damagerRelativePos = GetOwner()->GetActorLocation() - HitResult.GetActor()->GetActorLocation();
-        const float damage = currentTrace.BaseDamage;
-        FPointDamageEvent damageInfo;
-
-        damageInfo.DamageTypeClass = currentTrace.DamageTypeClass;
-        damageInfo.Damage = currentTrace.BaseDamage;
-        damageInfo.HitInfo = HitResult;
-        damageInfo.ShotDirection = damagerRelativePos;
-        HitResult.GetActor()->TakeDamage(damage, damageInfo, GetActorOwner()->GetInstigatorController(), GetActorOwner());
-
+        DealDamage(HitResult, currentTrace, GetOwner()->GetActorLocation(), GetActorOwner()->GetInstigatorController(), GetActorOwner());
         OnActorDamaged.Broadcast(HitResult.GetActor());
     }
 }
@@ -688,16 +703,37 @@ void UACMCollisionManagerComponent::ApplyAreaDamage(const FHitResult& HitResult,
 {
     if (IsValid(HitResult.GetActor()))
     {
-        float damage = currentTrace.BaseDamage;
-        FRadialDamageEvent damageInfo;
+        DealDamage(HitResult, currentTrace, GetOwner()->GetActorLocation(), GetActorOwner()->GetInstigatorController(), GetActorOwner());
+        OnActorDamaged.Broadcast(HitResult.GetActor());
+    }
+}
 
+// Deals the damage of the hit, point or area according to the trace config.
+void UACMCollisionManagerComponent::DealDamage(const FHitResult& HitResult, const FBaseTraceInfo& currentTrace, const FVector& damagerLocation, AController* instigator, AActor* damageCauser)
+{
+    AActor* damagedActor = HitResult.GetActor();
+    if (!IsValid(damagedActor))
+    {
+        return;
+    }
+
+    const float damage = currentTrace.BaseDamage;
+    if (currentTrace.DamageType == EDamageType::EArea)
+    {
+        FRadialDamageEvent damageInfo;
         damageInfo.DamageTypeClass = currentTrace.DamageTypeClass;
         damageInfo.Params.BaseDamage = currentTrace.BaseDamage;
         damageInfo.ComponentHits.Add(HitResult);
         damageInfo.Origin = HitResult.ImpactPoint;
-
-        HitResult.GetActor()->TakeDamage(damage, damageInfo, GetActorOwner()->GetInstigatorController(), GetActorOwner());
-        OnActorDamaged.Broadcast(HitResult.GetActor());
+        damagedActor->TakeDamage(damage, damageInfo, instigator, damageCauser);
+    } else
+    {
+        FPointDamageEvent damageInfo;
+        damageInfo.DamageTypeClass = currentTrace.DamageTypeClass;
+        damageInfo.Damage = currentTrace.BaseDamage;
+        damageInfo.HitInfo = HitResult;
+        damageInfo.ShotDirection = damagerLocation - damagedActor->GetActorLocation();
+        damagedActor->TakeDamage(damage, damageInfo, instigator, damageCauser);
     }
 }
 
@@ -0,0 +1,99 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACMDamageQueueSubsystem.h"
+#include "ACMCollisionManagerComponent.h"
+#include "Engine/World.h"
+#include <GameFramework/Actor.h>
+#include <GameFramework/Controller.h>
+
+void UACMDamageQueueSubsystem::QueueDamage(UACMCollisionManagerComponent* source, const FHitResult& hitResult, const FBaseTraceInfo& traceInfo)
+{
+    if (!source || !IsValid(hitResult.GetActor()))
+    {
+        return;
+    }
+
+    FACMQueuedDamage& queuedDamage = pendingDamages.AddDefaulted_GetRef();
+    queuedDamage.Source = source;
+    queuedDamage.HitResult = hitResult;
+    queuedDamage.TraceInfo = traceInfo;
+    if (AActor* damageCauser = source->GetActorOwner())
+    {
+        queuedDamage.DamageCauser = damageCauser;
+        queuedDamage.Instigator = damageCauser->GetInstigatorController();
+    }
+    if (const AActor* owner = source->GetOwner())
+    {
+        queuedDamage.DamagerLocation = owner->GetActorLocation();
+    }
+
+    // only listen to the world tick while something is pending
+    if (!postActorTickHandle.IsValid())
+    {
+        postActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UACMDamageQueueSubsystem::HandlePostActorTick);
+    }
+}
+
+void UACMDamageQueueSubsystem::FlushSourceDamages(UACMCollisionManagerComponent* source)
+{
+    TArray<FACMQueuedDamage> sourceDamages;
+    for (int32 index = 0; index < pendingDamages.Num(); ++index)
+    {
+        if (pendingDamages[index].Source.Get(/*bEvenIfPendingKill=*/ true) == source)
+        {
+            sourceDamages.Add(MoveTemp(pendingDamages[index]));
+            pendingDamages.RemoveAt(index--);
+        }
+    }
+
+    for (const FACMQueuedDamage& queuedDamage : sourceDamages)
+    {
+        source->ApplyDamage(queuedDamage.HitResult, queuedDamage.TraceInfo);
+    }
+}
+
+void UACMDamageQueueSubsystem::Deinitialize()
+{
+    FWorldDelegates::OnWorldPostActorTick.Remove(postActorTickHandle);
+    postActorTickHandle.Reset();
+    pendingDamages.Empty();
+
+    Super::Deinitialize();
+}
+
+void UACMDamageQueueSubsystem::HandlePostActorTick(UWorld* world, ELevelTick tickType, float deltaSeconds)
+{
+    if (world == GetWorld())
+    {
+        ApplyPendingDamages();
+    }
+}
+
+void UACMDamageQueueSubsystem::ApplyPendingDamages()
+{
+    FWorldDelegates::OnWorldPostActorTick.Remove(postActorTickHandle);
+    postActorTickHandle.Reset();
+
+    // damage can trigger new requests (e.g. an explosion on death), those are applied next frame
+    TArray<FACMQueuedDamage> damages = MoveTemp(pendingDamages);
+    pendingDamages.Reset();
+
+    for (const FACMQueuedDamage& queuedDamage : damages)
+    {
+        UACMCollisionManagerComponent* source = queuedDamage.Source.Get();
+        if (source)
+        {
+            source->ApplyDamage(queuedDamage.HitResult, queuedDamage.TraceInfo);
+        } else
+        {
+            ApplyQueuedDamage(queuedDamage);
+        }
+    }
+}
+
+void UACMDamageQueueSubsystem::ApplyQueuedDamage(const FACMQueuedDamage& queuedDamage)
+{
+    // the source is gone, deal the damage on behalf of what it was attached to
+    UACMCollisionManagerComponent::DealDamage(queuedDamage.HitResult, queuedDamage.TraceInfo, queuedDamage.DamagerLocation,
+        queuedDamage.Instigator.Get(), queuedDamage.DamageCauser.Get());
+}
@@ -1,6 +1,7 @@
 // Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
 
 #include "ACMEffectsDispatcherComponent.h"
+#include "ACMEffectsSubsystem.h"
 #include "ACMImpactsFXDataAsset.h"
 #include "ACMTypes.h"
 #include "GameFramework/Character.h"
@@ -13,7 +14,7 @@
 #include "NiagaraCommon.h"
 #include "NiagaraSystem.h"
 #include "Components/SkeletalMeshComponent.h"
-
+#include "Engine/World.h"
 
 // Sets default values for this component's properties
 UACMEffectsDispatcherComponent::UACMEffectsDispatcherComponent()
@@ -87,15 +88,14 @@ void UACMEffectsDispatcherComponent::Internal_PlayEffect(class ACharacter* insti
 {
     if (instigator) {
         switch (effect.SpawnLocation) {
-        case ESpawnFXLocation::ESpawnOnActorLocation:
-        case ESpawnFXLocation::ESpawnAttachedToSocketOrBone:
-            SpawnSoundAndParticleAttached(effect, instigator);
-            break;
         case ESpawnFXLocation::ESpawnAtLocation:
             SpawnSoundAndParticleAtLocation(FImpactFX(effect, effect.RelativeOffset));
             break;
+        case ESpawnFXLocation::ESpawnOnActorLocation:
+        case ESpawnFXLocation::ESpawnAttachedToSocketOrBone:
         default:
-            SpawnSoundAndParticleAttached(effect, instigator);
+            // one shots don't need their components back, so they go through the pools and the frame budget
+            QueueOneShotEffect(FImpactFX(effect, effect.RelativeOffset), instigator->GetMesh(), effect.SocketOrBoneName);
             break;
         }
     }
@@ -123,17 +123,15 @@ FAttachedComponents UACMEffectsDispatcherComponent::SpawnSoundAndParticleAttache
 
 void UACMEffectsDispatcherComponent::SpawnSoundAndParticleAtLocation(const FImpactFX& effect)
 {
-    if (effect.ActionParticle) {
-        UGameplayStatics::SpawnEmitterAtLocation(this, effect.ActionParticle, effect.SpawnLocation.GetLocation(),
-            effect.SpawnLocation.GetRotation().Rotator(), effect.SpawnLocation.GetScale3D());
-    }
-
-    if (effect.ActionSound) {
-        UGameplayStatics::SpawnSoundAtLocation(this, effect.ActionSound, effect.SpawnLocation.GetLocation());
-    }
+    QueueOneShotEffect(effect, nullptr, NAME_None);
+}
 
-    if (effect.NiagaraParticle) {
-        UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, effect.NiagaraParticle, effect.SpawnLocation.GetLocation(),
-            effect.SpawnLocation.GetRotation().Rotator(), effect.SpawnLocation.GetScale3D());
+void UACMEffectsDispatcherComponent::QueueOneShotEffect(const FImpactFX& effect, USceneComponent* attachParent, const FName& socketOrBoneName)
+{
+    // the budget and the pools are shared by every dispatcher of the world
+    UWorld* world = GetWorld();
+    UACMEffectsSubsystem* effectsSubsystem = world ? world->GetSubsystem<UACMEffectsSubsystem>() : nullptr;
+    if (effectsSubsystem) {
+        effectsSubsystem->QueueOneShotEffect(effect, attachParent, socketOrBoneName);
     }
 }
@@ -0,0 +1,224 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACMEffectsSubsystem.h"
+#include "ACMDeveloperSettings.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/AudioComponent.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "NiagaraCommon.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraSystem.h"
+#include "Particles/ParticleSystem.h"
+#include <Sound/SoundBase.h>
+
+DECLARE_STATS_GROUP(TEXT("ACM Effects"), STATGROUP_ACMEffects, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Flush Pending Effects"), STAT_ACMFlushPendingEffects, STATGROUP_ACMEffects);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawned Effects"), STAT_ACMSpawnedEffects, STATGROUP_ACMEffects);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Culled Effects"), STAT_ACMCulledEffects, STATGROUP_ACMEffects);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Over Budget Effects"), STAT_ACMOverBudgetEffects, STATGROUP_ACMEffects);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reused Pooled Sounds"), STAT_ACMReusedPooledSounds, STATGROUP_ACMEffects);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Created Pooled Sounds"), STAT_ACMCreatedPooledSounds, STATGROUP_ACMEffects);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Idle Pooled Sounds"), STAT_ACMIdlePooledSounds, STATGROUP_ACMEffects);
+
+void UACMEffectsSubsystem::QueueOneShotEffect(const FImpactFX& effect, USceneComponent* attachParent, const FName& socketOrBoneName)
+{
+    // nobody to show it to
+    const UWorld* world = GetWorld();
+    if (!world || world->GetNetMode() == NM_DedicatedServer) {
+        return;
+    }
+
+    const FACMEffectCategorySettings* settings = GetDefault<UACMDeveloperSettings>()->EffectCategories.Find(effect.EffectCategory);
+    const FVector location = attachParent ? attachParent->GetSocketTransform(socketOrBoneName).TransformPosition(effect.SpawnLocation.GetLocation())
+                                          : effect.SpawnLocation.GetLocation();
+    if (IsCulled(settings, location)) {
+        INC_DWORD_STAT(STAT_ACMCulledEffects);
+        return;
+    }
+
+    FACMPendingEffect& pendingEffect = pendingEffects.AddDefaulted_GetRef();
+    pendingEffect.Effect = effect;
+    pendingEffect.AttachParent = attachParent;
+    pendingEffect.SocketOrBoneName = socketOrBoneName;
+    pendingEffect.Priority = settings ? settings->Priority : 0;
+
+    // only listen to the world tick while something is pending
+    if (!postActorTickHandle.IsValid()) {
+        postActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UACMEffectsSubsystem::HandlePostActorTick);
+    }
+}
+
+void UACMEffectsSubsystem::Deinitialize()
+{
+    FWorldDelegates::OnWorldPostActorTick.Remove(postActorTickHandle);
+    postActorTickHandle.Reset();
+    pendingEffects.Empty();
+
+    // stopping a sound fires its finished delegate, so the pools are emptied first
+    const TMap<TObjectPtr<USoundBase>, FACMAudioPool> pools = MoveTemp(audioPools);
+    audioPools.Empty();
+    for (const auto& pool : pools) {
+        for (UAudioComponent* audioComp : pool.Value.FreeComponents) {
+            DEC_DWORD_STAT(STAT_ACMIdlePooledSounds);
+            if (IsValid(audioComp)) {
+                audioComp->DestroyComponent();
+            }
+        }
+        for (UAudioComponent* audioComp : pool.Value.ActiveComponents) {
+            if (IsValid(audioComp)) {
+                audioComp->DestroyComponent();
+            }
+        }
+    }
+
+    Super::Deinitialize();
+}
+
+void UACMEffectsSubsystem::HandlePostActorTick(UWorld* world, ELevelTick tickType, float deltaSeconds)
+{
+    if (world == GetWorld()) {
+        FlushPendingEffects();
+    }
+}
+
+void UACMEffectsSubsystem::FlushPendingEffects()
+{
+    SCOPE_CYCLE_COUNTER(STAT_ACMFlushPendingEffects);
+
+    FWorldDelegates::OnWorldPostActorTick.Remove(postActorTickHandle);
+    postActorTickHandle.Reset();
+
+    TArray<FACMPendingEffect> effects = MoveTemp(pendingEffects);
+    pendingEffects.Reset();
+    effects.StableSort([](const FACMPendingEffect& a, const FACMPendingEffect& b) {
+        return a.Priority > b.Priority;
+    });
+
+    const UACMDeveloperSettings* budget = GetDefault<UACMDeveloperSettings>();
+    TMap<EACMEffectCategory, int32> categorySpawns;
+    int32 frameSpawns = 0;
+    for (const FACMPendingEffect& pendingEffect : effects) {
+        const FACMEffectCategorySettings* settings = budget->EffectCategories.Find(pendingEffect.Effect.EffectCategory);
+        int32& categoryCount = categorySpawns.FindOrAdd(pendingEffect.Effect.EffectCategory);
+        const bool bCategoryFull = settings && settings->MaxSpawnsPerFrame > 0 && categoryCount >= settings->MaxSpawnsPerFrame;
+        const bool bFrameFull = budget->MaxSpawnsPerFrame > 0 && frameSpawns >= budget->MaxSpawnsPerFrame;
+        if (bCategoryFull || bFrameFull) {
+            INC_DWORD_STAT(STAT_ACMOverBudgetEffects);
+            continue;
+        }
+
+        SpawnOneShotEffect(pendingEffect);
+        categoryCount++;
+        frameSpawns++;
+    }
+}
+
+void UACMEffectsSubsystem::SpawnOneShotEffect(const FACMPendingEffect& pendingEffect)
+{
+    const FImpactFX& effect = pendingEffect.Effect;
+    USceneComponent* attachParent = pendingEffect.AttachParent.Get();
+    if (!pendingEffect.AttachParent.IsExplicitlyNull() && !attachParent) {
+        // the owner died before the end of the frame
+        return;
+    }
+
+    const FTransform& transform = effect.SpawnLocation;
+    if (effect.ActionParticle) {
+        if (attachParent) {
+            UGameplayStatics::SpawnEmitterAttached(effect.ActionParticle, attachParent, pendingEffect.SocketOrBoneName,
+                transform.GetLocation(), transform.GetRotation().Rotator(), transform.GetScale3D(),
+                EAttachLocation::KeepRelativeOffset, true, EPSCPoolMethod::AutoRelease);
+        } else {
+            UGameplayStatics::SpawnEmitterAtLocation(this, effect.ActionParticle, transform.GetLocation(),
+                transform.GetRotation().Rotator(), transform.GetScale3D(), true, EPSCPoolMethod::AutoRelease);
+        }
+    }
+
+    if (effect.ActionSound) {
+        PlayPooledSound(effect.ActionSound, attachParent, pendingEffect.SocketOrBoneName, transform);
+    }
+
+    if (effect.NiagaraParticle) {
+        if (attachParent) {
+            UNiagaraFunctionLibrary::SpawnSystemAttached(effect.NiagaraParticle, attachParent, pendingEffect.SocketOrBoneName,
+                transform.GetLocation(), transform.GetRotation().Rotator(), transform.GetScale3D(),
+                EAttachLocation::SnapToTarget, true, ENCPoolMethod::AutoRelease);
+        } else {
+            UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, effect.NiagaraParticle, transform.GetLocation(),
+                transform.GetRotation().Rotator(), transform.GetScale3D(), true, true, ENCPoolMethod::AutoRelease);
+        }
+    }
+    INC_DWORD_STAT(STAT_ACMSpawnedEffects);
+}
+
+UAudioComponent* UACMEffectsSubsystem::PlayPooledSound(USoundBase* sound, USceneComponent* attachParent, const FName& socketOrBoneName, const FTransform& transform)
+{
+    FACMAudioPool& pool = audioPools.FindOrAdd(sound);
+
+    UAudioComponent* audioComp = nullptr;
+    while (!audioComp && pool.FreeComponents.Num() > 0) {
+        audioComp = pool.FreeComponents.Pop();
+        DEC_DWORD_STAT(STAT_ACMIdlePooledSounds);
+        if (!IsValid(audioComp)) {
+            audioComp = nullptr;
+        }
+    }
+
+    if (audioComp) {
+        INC_DWORD_STAT(STAT_ACMReusedPooledSounds);
+        audioComp->SetWorldLocation(transform.GetLocation());
+    } else {
+        // spawned in the world rather than on the instigator, so it survives it and can be reused by anyone
+        audioComp = UGameplayStatics::SpawnSoundAtLocation(this, sound, transform.GetLocation(), FRotator::ZeroRotator,
+            1.f, 1.f, 0.f, nullptr, nullptr, false);
+        if (!audioComp) {
+            return nullptr;
+        }
+        INC_DWORD_STAT(STAT_ACMCreatedPooledSounds);
+        audioComp->OnAudioFinishedNative.AddUObject(this, &UACMEffectsSubsystem::HandlePooledSoundFinished);
+    }
+
+    if (attachParent) {
+        audioComp->AttachToComponent(attachParent, FAttachmentTransformRules::SnapToTargetNotIncludingScale, socketOrBoneName);
+    }
+    if (!audioComp->IsPlaying()) {
+        audioComp->Play();
+    }
+    pool.ActiveComponents.Add(audioComp);
+    return audioComp;
+}
+
+void UACMEffectsSubsystem::HandlePooledSoundFinished(UAudioComponent* audioComp)
+{
+    if (!IsValid(audioComp)) {
+        return;
+    }
+
+    FACMAudioPool* pool = audioPools.Find(audioComp->Sound);
+    if (pool) {
+        pool->ActiveComponents.RemoveSwap(audioComp);
+    }
+
+    if (!pool || pool->FreeComponents.Num() >= GetDefault<UACMDeveloperSettings>()->MaxPooledAudioPerSound) {
+        audioComp->DestroyComponent();
+        return;
+    }
+
+    audioComp->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+    pool->FreeComponents.Add(audioComp);
+    INC_DWORD_STAT(STAT_ACMIdlePooledSounds);
+}
+
+bool UACMEffectsSubsystem::IsCulled(const FACMEffectCategorySettings* settings, const FVector& location) const
+{
+    if (!settings || settings->CullDistance <= 0.f) {
+        return false;
+    }
+
+    const APlayerCameraManager* cameraManager = UGameplayStatics::GetPlayerCameraManager(this, 0);
+    if (!cameraManager) {
+        return false;
+    }
+    return FVector::DistSquared(cameraManager->GetCameraLocation(), location) > FMath::Square(settings->CullDistance);
+}
@@ -10,7 +10,7 @@ bool UACMImpactsFXDataAsset::TryGetImpactFX(const TSubclassOf<class UDamageType>
 
         if (impacts.ImpactsFX.Contains(materialImpacted)) {
             const FMaterialImpactFX* matfx = impacts.ImpactsFX.FindByKey(materialImpacted);
-            outFXtoPlay = FBaseFX(matfx->ActionSound, matfx->NiagaraParticle, matfx->ActionParticle);
+            outFXtoPlay = FBaseFX(matfx->ActionSound, matfx->NiagaraParticle, matfx->ActionParticle, matfx->EffectCategory);
             return true;
         } 
     } else {
@@ -19,7 +19,7 @@ bool UACMImpactsFXDataAsset::TryGetImpactFX(const TSubclassOf<class UDamageType>
         if (damageImpacting->IsChildOf(impfx.Key)) {
                 const FImpactsArray& impacts = ImpactFXsByDamageType.FindChecked(impfx.Key);
                 const FMaterialImpactFX* matfx = impacts.ImpactsFX.FindByKey(materialImpacted);
-                outFXtoPlay = FBaseFX(matfx->ActionSound, matfx->NiagaraParticle, matfx->ActionParticle);
+                outFXtoPlay = FBaseFX(matfx->ActionSound, matfx->NiagaraParticle, matfx->ActionParticle, matfx->EffectCategory);
                 return true;
             }
         }
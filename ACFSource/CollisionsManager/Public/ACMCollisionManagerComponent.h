@@ -49,6 +49,8 @@ class COLLISIONSMANAGER_API UACMCollisionManagerComponent : public UActorCompone
 
     GENERATED_BODY()
 
+    friend class UACMDamageQueueSubsystem;
+
 public:
     /** Default constructor: initializes defaults. */
     UACMCollisionManagerComponent();
@@ -335,12 +337,18 @@ private:
     /** Applies damage to a hit result using the current trace configuration. */
     void ApplyDamage(const FHitResult& HitResult, const FBaseTraceInfo& currentTrace);
 
+    /** Queues the damage of the hit in the world damage queue, applied at the end of the frame. */
+    void QueueDamage(const FHitResult& HitResult, const FBaseTraceInfo& currentTrace);
+
     /** Applies point damage (single target, e.g., sword poke). */
     void ApplyPointDamage(const FHitResult& HitResult, const FBaseTraceInfo& currentTrace);
 
     /** Applies area damage (AOE, e.g., explosion pulse). */
     void ApplyAreaDamage(const FHitResult& HitResult, const FBaseTraceInfo& currentTrace);
 
+    /** Deals the point or area damage of the hit without a component, e.g. for queued damage whose source is gone. */
+    static void DealDamage(const FHitResult& HitResult, const FBaseTraceInfo& currentTrace, const FVector& damagerLocation, AController* instigator, AActor* damageCauser);
+
     /** Timer for all traces running at once. */
     UPROPERTY()
     FTimerHandle AllTraceTimer;
@@ -0,0 +1,59 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "ACMTypes.h"
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ACMDamageQueueSubsystem.generated.h"
+
+class AController;
+class UACMCollisionManagerComponent;
+
+/**
+ * UACMDamageQueueSubsystem
+ *
+ * Frame level queue for the damage dealt by area and multi-hit sources.
+ * This only defers: each request is still applied on its own, through its source, once actors and timers
+ * have ticked. Duplicates within a single area call are already filtered by the source, separate calls are
+ * all applied, and requests of different sources on the same actor are not merged.
+ * Each request keeps its damage causer and instigator, so it is still applied if its source is gone.
+ */
+UCLASS()
+class COLLISIONSMANAGER_API UACMDamageQueueSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Queues the damage of the provided hit, applied at the end of the frame. */
+    void QueueDamage(UACMCollisionManagerComponent* source, const FHitResult& hitResult, const FBaseTraceInfo& traceInfo);
+
+    /** Applies right away the pending requests of the source, called when it stops playing. */
+    void FlushSourceDamages(UACMCollisionManagerComponent* source);
+
+    virtual void Deinitialize() override;
+
+private:
+    struct FACMQueuedDamage
+    {
+        TWeakObjectPtr<UACMCollisionManagerComponent> Source;
+        FHitResult HitResult;
+        FBaseTraceInfo TraceInfo;
+        TWeakObjectPtr<AActor> DamageCauser;
+        TWeakObjectPtr<AController> Instigator;
+        FVector DamagerLocation = FVector::ZeroVector;
+    };
+
+    /** Requests of the current frame, in queue order */
+    TArray<FACMQueuedDamage> pendingDamages;
+
+    FDelegateHandle postActorTickHandle;
+
+    void HandlePostActorTick(UWorld* world, ELevelTick tickType, float deltaSeconds);
+
+    void ApplyPendingDamages();
+
+    static void ApplyQueuedDamage(const FACMQueuedDamage& queuedDamage);
+};
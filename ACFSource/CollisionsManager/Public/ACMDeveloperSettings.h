@@ -0,0 +1,30 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "ACMTypes.h"
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+
+#include "ACMDeveloperSettings.generated.h"
+
+/**
+ * Budget of the one shot effects spawned by the effects subsystem, shared by every effects dispatcher of the world
+ */
+UCLASS(config = Plugins, defaultconfig, meta = (DisplayName = "Ascent Collisions Manager"))
+class COLLISIONSMANAGER_API UACMDeveloperSettings : public UDeveloperSettings {
+    GENERATED_BODY()
+
+public:
+    /** Priority, cull distance and per frame cap of one shot effects, by category. Missing categories are never culled*/
+    UPROPERTY(EditAnywhere, config, Category = "ACM | Effects Budget")
+    TMap<EACMEffectCategory, FACMEffectCategorySettings> EffectCategories;
+
+    /** Max one shot effects spawned in a single frame, lower priority categories are dropped first. 0 means unlimited*/
+    UPROPERTY(EditAnywhere, config, Category = "ACM | Effects Budget", meta = (ClampMin = 0))
+    int32 MaxSpawnsPerFrame = 24;
+
+    /** Max idle audio components kept for each sound*/
+    UPROPERTY(EditAnywhere, config, Category = "ACM | Effects Budget", meta = (ClampMin = 0))
+    int32 MaxPooledAudioPerSound = 4;
+};
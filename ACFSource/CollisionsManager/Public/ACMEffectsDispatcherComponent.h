@@ -7,6 +7,7 @@
 #include "ACMTypes.h"
 #include "ACMEffectsDispatcherComponent.generated.h"
 
+class USceneComponent;
 
 UCLASS(ClassGroup = (ACF), meta = (BlueprintSpawnableComponent))
 class COLLISIONSMANAGER_API UACMEffectsDispatcherComponent : public UActorComponent
@@ -23,8 +24,12 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, Category = ACM)
 	class UACMImpactsFXDataAsset* ImpactFXs;
+
 private:
 
+	/** Hands the one shot effect to the world effects subsystem, which owns the frame budget and the pools*/
+	void QueueOneShotEffect(const FImpactFX& effect, USceneComponent* attachParent, const FName& socketOrBoneName);
+
 	UFUNCTION(NetMulticast, Reliable, Category = ACM)
 	void ClientsPlayEffect(const FActionEffect& effect, class ACharacter* instigator );
 
@@ -36,6 +41,8 @@ private:
 public:	
 
 	FAttachedComponents SpawnSoundAndParticleAttached(const FActionEffect& effect, class ACharacter* instigator);
+
+	/** Queues a pooled one shot effect, spawned at the end of the frame if it's within its category budget*/
     void SpawnSoundAndParticleAtLocation(const FImpactFX& effect);
 	UFUNCTION(BlueprintCallable, Server,  Reliable,  Category = ACM)
 	void PlayReplicatedActionEffect(const FActionEffect& effect, class ACharacter* instigator);
@@ -0,0 +1,74 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "ACMTypes.h"
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ACMEffectsSubsystem.generated.h"
+
+class UAudioComponent;
+class USceneComponent;
+class USoundBase;
+
+/** Idle audio components of a single sound, played again instead of spawning new ones*/
+USTRUCT()
+struct FACMAudioPool {
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<TObjectPtr<UAudioComponent>> FreeComponents;
+
+    /** Components currently playing, given back to FreeComponents once finished*/
+    UPROPERTY()
+    TArray<TObjectPtr<UAudioComponent>> ActiveComponents;
+};
+
+/**
+ * UACMEffectsSubsystem
+ *
+ * Frame level queue for the one shot effects of every effects dispatcher in the world.
+ * Requests are collected during the frame and spawned once actors have ticked, higher priority categories first,
+ * within the frame and category budgets of UACMDeveloperSettings. Sounds are played from pools shared by the whole world.
+ */
+UCLASS()
+class COLLISIONSMANAGER_API UACMEffectsSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Queues a pooled one shot effect, spawned at the end of the frame if it's within its category budget*/
+    void QueueOneShotEffect(const FImpactFX& effect, USceneComponent* attachParent, const FName& socketOrBoneName);
+
+    virtual void Deinitialize() override;
+
+private:
+    /** One shot effect waiting for the end of the frame to be spawned*/
+    struct FACMPendingEffect {
+        FImpactFX Effect;
+        TWeakObjectPtr<USceneComponent> AttachParent;
+        FName SocketOrBoneName;
+        uint8 Priority = 0;
+    };
+
+    /** Requests of the current frame, from every dispatcher*/
+    TArray<FACMPendingEffect> pendingEffects;
+
+    FDelegateHandle postActorTickHandle;
+
+    UPROPERTY()
+    TMap<TObjectPtr<USoundBase>, FACMAudioPool> audioPools;
+
+    void HandlePostActorTick(UWorld* world, ELevelTick tickType, float deltaSeconds);
+
+    void FlushPendingEffects();
+
+    void SpawnOneShotEffect(const FACMPendingEffect& pendingEffect);
+
+    UAudioComponent* PlayPooledSound(USoundBase* sound, USceneComponent* attachParent, const FName& socketOrBoneName, const FTransform& transform);
+
+    void HandlePooledSoundFinished(UAudioComponent* audioComp);
+
+    bool IsCulled(const FACMEffectCategorySettings* settings, const FVector& location) const;
+};
@@ -77,6 +77,39 @@ enum class ESpawnFXLocation : uint8 {
     ESpawnAtLocation UMETA(DisplayName = "Spawn On Provided Tranform")
 };
 
+/** Used by the effects subsystem to pick the budget, priority and cull distance of a one shot effect */
+UENUM(BlueprintType)
+enum class EACMEffectCategory : uint8 {
+    EDefault = 0 UMETA(DisplayName = "Default"),
+    EImpact = 1 UMETA(DisplayName = "Impact"),
+    EAction = 2 UMETA(DisplayName = "Action"),
+    EFootstep = 3 UMETA(DisplayName = "Footstep"),
+    EAmbient = 4 UMETA(DisplayName = "Ambient"),
+};
+
+USTRUCT(BlueprintType)
+struct FACMEffectCategorySettings {
+    GENERATED_BODY()
+
+    FACMEffectCategorySettings()
+        : Priority(0)
+        , CullDistance(0.f)
+        , MaxSpawnsPerFrame(0)
+    {}
+
+    /** When the frame budget is exceeded, effects of higher priority categories are spawned first*/
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACM)
+    uint8 Priority;
+
+    /** Effects further than this from the local camera are not spawned at all. 0 means never culled*/
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACM, meta = (ClampMin = 0))
+    float CullDistance;
+
+    /** Max effects of this category spawned in a single frame. 0 means only the global budget applies*/
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACM, meta = (ClampMin = 0))
+    int32 MaxSpawnsPerFrame;
+};
+
 USTRUCT(BlueprintType)
 struct FBaseFX : public FTableRowBase {
     GENERATED_BODY()
@@ -85,12 +118,14 @@ struct FBaseFX : public FTableRowBase {
         : ActionSound(nullptr)
         , NiagaraParticle(nullptr)
         , ActionParticle(nullptr)
+        , EffectCategory(EACMEffectCategory::EDefault)
     {}
 
-    FBaseFX(USoundBase* InSound, UNiagaraSystem* InNiagara, UParticleSystem* InCascade)
+    FBaseFX(USoundBase* InSound, UNiagaraSystem* InNiagara, UParticleSystem* InCascade, EACMEffectCategory InCategory = EACMEffectCategory::EDefault)
         : ActionSound(InSound)
         , NiagaraParticle(InNiagara)
         , ActionParticle(InCascade)
+        , EffectCategory(InCategory)
     {}
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACF)
@@ -101,6 +136,10 @@ struct FBaseFX : public FTableRowBase {
 
     UPROPERTY(EditAnywhere, meta = (DeprecatedFunction, DeprecationMessage = "USE NIAGARA PARTICLE!!"), BlueprintReadWrite, Category = ACF)
     class UParticleSystem* ActionParticle;
+
+    /** Budget, priority and cull distance used when this is played as a one shot effect*/
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACF)
+    EACMEffectCategory EffectCategory;
 };
 
 USTRUCT(BlueprintType)
@@ -171,6 +210,7 @@ struct FImpactFX : public FBaseFX {
         ActionSound = nullptr;
         NiagaraParticle = nullptr;
         ActionParticle = nullptr;
+        EffectCategory = EACMEffectCategory::EDefault;
         SpawnLocation = FTransform();
     }
 
@@ -179,6 +219,7 @@ struct FImpactFX : public FBaseFX {
         ActionSound = baseFX.ActionSound;
         NiagaraParticle = baseFX.NiagaraParticle;
         ActionParticle = baseFX.ActionParticle;
+        EffectCategory = baseFX.EffectCategory;
         SpawnLocation = FTransform(location);
     }
 
@@ -187,6 +228,7 @@ struct FImpactFX : public FBaseFX {
         ActionSound = baseFX.ActionSound;
         NiagaraParticle = baseFX.NiagaraParticle;
         ActionParticle = baseFX.ActionParticle;
+        EffectCategory = baseFX.EffectCategory;
         SpawnLocation = location;
     }
 
@@ -195,6 +237,7 @@ struct FImpactFX : public FBaseFX {
         ActionSound = baseFX.ActionSound;
         NiagaraParticle = baseFX.NiagaraParticle;
         ActionParticle = baseFX.ActionParticle;
+        EffectCategory = baseFX.EffectCategory;
         SpawnLocation = baseFX.SpawnLocation;
     }
 
@@ -209,7 +252,9 @@ struct FMaterialImpactFX : public FBaseFX {
     FMaterialImpactFX()
         : FBaseFX()
         , ImpactMaterial(nullptr)
-    {}
+    {
+        EffectCategory = EACMEffectCategory::EImpact;
+    }
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACF)
     UPhysicalMaterial* ImpactMaterial;
@@ -0,0 +1,134 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFCraftabilityIndex.h"
+#include "Components/ACFEquipmentComponent.h"
+
+void UACFCraftabilityIndex::Initialize(UACFEquipmentComponent* InEquipment, const TArray<FACFCraftingRecipe>& Recipes)
+{
+    if (UACFEquipmentComponent* OldEquipment = Equipment.Get())
+    {
+        OldEquipment->OnItemAdded.RemoveDynamic(this, &UACFCraftabilityIndex::HandleItemAdded);
+        OldEquipment->OnItemRemoved.RemoveDynamic(this, &UACFCraftabilityIndex::HandleItemRemoved);
+        OldEquipment->OnInventoryReloaded.RemoveDynamic(this, &UACFCraftabilityIndex::HandleInventoryReloaded);
+    }
+
+    Equipment = InEquipment;
+    ItemCounts.Reset();
+    if (InEquipment)
+    {
+        InEquipment->OnItemAdded.AddUniqueDynamic(this, &UACFCraftabilityIndex::HandleItemAdded);
+        InEquipment->OnItemRemoved.AddUniqueDynamic(this, &UACFCraftabilityIndex::HandleItemRemoved);
+        InEquipment->OnInventoryReloaded.AddUniqueDynamic(this, &UACFCraftabilityIndex::HandleInventoryReloaded);
+        for (const FInventoryItem& Item : InEquipment->GetInventory())
+        {
+            ItemCounts.FindOrAdd(Item.ItemClass) += Item.Count;
+        }
+    }
+
+    SetRecipes(Recipes);
+}
+
+void UACFCraftabilityIndex::SetRecipes(const TArray<FACFCraftingRecipe>& Recipes)
+{
+    IndexedRecipes = Recipes;
+    RecipesByIngredient.Reset();
+    for (int32 RecipeIndex = 0; RecipeIndex < IndexedRecipes.Num(); RecipeIndex++)
+    {
+        for (const FBaseItem& Required : IndexedRecipes[RecipeIndex].RequiredItems)
+        {
+            RecipesByIngredient.FindOrAdd(Required.ItemClass).AddUnique(RecipeIndex);
+        }
+    }
+
+    MaxCraftableAmounts.Init(0, IndexedRecipes.Num());
+    DirtyRecipes.Init(true, IndexedRecipes.Num());
+}
+
+int32 UACFCraftabilityIndex::GetItemCount(const TSubclassOf<AACFItem>& ItemClass) const
+{
+    const int32* Count = ItemCounts.Find(ItemClass);
+    return Count ? *Count : 0;
+}
+
+int32 UACFCraftabilityIndex::ComputeMaxCraftableAmount(const FACFCraftingRecipe& Recipe) const
+{
+    int32 MaxCraftable = TNumericLimits<int32>::Max();
+    for (const FBaseItem& Required : Recipe.RequiredItems)
+    {
+        if (!Required.ItemClass || Required.Count <= 0)
+        {
+            return 0;
+        }
+        MaxCraftable = FMath::Min(MaxCraftable, GetItemCount(Required.ItemClass) / Required.Count);
+    }
+
+    // Recipes without requirements are not craftable, matching the inventory based evaluation
+    return MaxCraftable == TNumericLimits<int32>::Max() ? 0 : MaxCraftable;
+}
+
+int32 UACFCraftabilityIndex::GetMaxCraftableAmount(int32 RecipeIndex)
+{
+    if (!IndexedRecipes.IsValidIndex(RecipeIndex))
+    {
+        return 0;
+    }
+
+    if (DirtyRecipes[RecipeIndex])
+    {
+        MaxCraftableAmounts[RecipeIndex] = ComputeMaxCraftableAmount(IndexedRecipes[RecipeIndex]);
+        DirtyRecipes[RecipeIndex] = false;
+    }
+    return MaxCraftableAmounts[RecipeIndex];
+}
+
+void UACFCraftabilityIndex::HandleItemAdded(const FBaseItem& Item)
+{
+    ApplyItemDelta(Item.ItemClass, Item.Count);
+}
+
+void UACFCraftabilityIndex::HandleItemRemoved(const FBaseItem& Item)
+{
+    ApplyItemDelta(Item.ItemClass, -Item.Count);
+}
+
+void UACFCraftabilityIndex::HandleInventoryReloaded(const TArray<FInventoryItem>& Inventory)
+{
+    RecountItems(Inventory);
+}
+
+void UACFCraftabilityIndex::ApplyItemDelta(const TSubclassOf<AACFItem>& ItemClass, int32 Delta)
+{
+    if (!ItemClass || Delta == 0)
+    {
+        return;
+    }
+
+    int32& Count = ItemCounts.FindOrAdd(ItemClass);
+    Count = FMath::Max(0, Count + Delta);
+    if (Count == 0)
+    {
+        ItemCounts.Remove(ItemClass);
+    }
+    DirtyRecipesUsing(ItemClass);
+}
+
+void UACFCraftabilityIndex::RecountItems(const TArray<FInventoryItem>& Inventory)
+{
+    ItemCounts.Reset();
+    for (const FInventoryItem& Item : Inventory)
+    {
+        ItemCounts.FindOrAdd(Item.ItemClass) += Item.Count;
+    }
+    DirtyRecipes.Init(true, IndexedRecipes.Num());
+}
+
+void UACFCraftabilityIndex::DirtyRecipesUsing(const TSubclassOf<AACFItem>& ItemClass)
+{
+    if (const TArray<int32>* Recipes = RecipesByIngredient.Find(ItemClass))
+    {
+        for (const int32 RecipeIndex : *Recipes)
+        {
+            DirtyRecipes[RecipeIndex] = true;
+        }
+    }
+}
@@ -1,8 +1,12 @@
 #include "ACFCraftingComponent.h"
+#include "ACFCraftabilityIndex.h"
 #include "ACFItemsManagerComponent.h"
 #include "Components/ACFEquipmentComponent.h"
 #include "ACFCraftRecipeDataAsset.h"
 #include "Actors/ACFCharacter.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
 
 // Constructor disables ticking by default
 UACFCraftingComponent::UACFCraftingComponent()
@@ -10,6 +14,12 @@ UACFCraftingComponent::UACFCraftingComponent()
     PrimaryComponentTick.bCanEverTick = false;
 }
 
+void UACFCraftingComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+    DOREPLIFETIME(UACFCraftingComponent, CraftingState);
+}
+
 // On begin play, populate CraftableItems from editable data assets
 void UACFCraftingComponent::BeginPlay()
 {
@@ -175,7 +185,7 @@ bool UACFCraftingComponent::TryGetCraftableRecipeForItem(const FBaseItem& recipe
  * Calculates the maximum number of times the given recipe can be crafted
  * based on the pawn’s current inventory counts.
  */
-int32 UACFCraftingComponent::GetMaxCraftableAmount(const FACFCraftingRecipe& Recipe, const APawn* Pawn) const
+int32 UACFCraftingComponent::GetMaxCraftableAmount(const FACFCraftingRecipe& Recipe, const APawn* Pawn)
 {
     if (!Pawn)
     {
@@ -183,47 +193,80 @@ int32 UACFCraftingComponent::GetMaxCraftableAmount(const FACFCraftingRecipe& Rec
         return 0;
     }
     
-    // Retrieve the pawn’s equipment component to access their inventory.
-    UACFEquipmentComponent* EquipComp = GetPawnEquipment(Pawn);
-    if (!EquipComp)
+    // Item counts come from the pawn's craftability cache instead of walking the inventory for each ingredient.
+    UACFCraftabilityIndex* Index = GetCraftabilityIndex(Pawn);
+    if (!Index)
     {
         UE_LOG(LogTemp, Warning, TEXT("[Crafting] No EquipmentComponent on pawn %s"), *Pawn->GetName());
         return 0;
     }
 
-    // Start with an “infinite” upper bound; we’ll take the minimum across all requirements.
-    int32 MaxCraftable = TNumericLimits<int32>::Max();
+    // Smallest Available / Required ratio across the requirements, 0 if the recipe has none.
+    return Index->ComputeMaxCraftableAmount(Recipe);
+}
+
+TArray<FACFCraftingRecipe> UACFCraftingComponent::GetCraftableNowRecipes(const APawn* Pawn)
+{
+    TArray<FACFCraftingRecipe> Result;
+    if (!Pawn)
+    {
+        return Result;
+    }
+
+    UACFCraftabilityIndex* Index = GetCraftabilityIndex(Pawn);
+    if (!Index)
+    {
+        return Result;
+    }
 
-    // Loop through each item required by the recipe.
-    for (const FBaseItem& Required : Recipe.RequiredItems)
+    const float Currency = GetPawnCurrency(Pawn);
+    for (int32 RecipeIndex = 0; RecipeIndex < CraftableItems.Num(); RecipeIndex++)
     {
-        if (!Required.ItemClass)
+        const FACFCraftingRecipe& Recipe = CraftableItems[RecipeIndex];
+        if (Index->GetMaxCraftableAmount(RecipeIndex) > 0 && Currency >= PriceMultiplierOnSell * Recipe.CraftingCost)
         {
-            UE_LOG(LogTemp, Warning, TEXT("[Crafting] Recipe has null Required.ItemClass"));
-            return 0;
+            Result.Add(Recipe);
         }
-        
-        // Count how many of this class the pawn currently has in total.
-        int32 AvailableCount = EquipComp->GetTotalCountOfItemsByClass(Required.ItemClass);
-
-        // Determine how many crafts this one resource alone would permit.
-        // If Required.Count is zero (shouldn’t happen), we default to 0 to avoid division by zero.
-        int32 ThisItemAllows = (Required.Count > 0)
-            ? (AvailableCount / Required.Count)
-            : 0;
+    }
+    return Result;
+}
 
-        // The recipe’s overall limit is the smallest of these per-resource limits.
-        MaxCraftable = FMath::Min(MaxCraftable, ThisItemAllows);
+UACFCraftabilityIndex* UACFCraftingComponent::GetCraftabilityIndex(const APawn* Pawn)
+{
+    UACFEquipmentComponent* EquipComp = GetPawnEquipment(Pawn);
+    if (!EquipComp)
+    {
+        return nullptr;
     }
 
-    // If no requirements existed (MaxCraftable still Max int), clamp it down to 0.
-    if (MaxCraftable == TNumericLimits<int32>::Max())
+    // Drop the caches of players that are gone and re-index the recipes if they changed
+    UACFCraftabilityIndex* Found = nullptr;
+    for (int32 Index = CraftabilityIndices.Num() - 1; Index >= 0; --Index)
     {
-        MaxCraftable = 0;
+        UACFCraftabilityIndex* CraftabilityIndex = CraftabilityIndices[Index];
+        if (!CraftabilityIndex || !CraftabilityIndex->GetEquipment())
+        {
+            CraftabilityIndices.RemoveAtSwap(Index);
+            continue;
+        }
+        if (bCraftabilityRecipesDirty)
+        {
+            CraftabilityIndex->SetRecipes(CraftableItems);
+        }
+        if (CraftabilityIndex->GetEquipment() == EquipComp)
+        {
+            Found = CraftabilityIndex;
+        }
     }
+    bCraftabilityRecipesDirty = false;
 
-    // Return the maximum number of complete recipe iterations possible.
-    return MaxCraftable;
+    if (!Found)
+    {
+        Found = NewObject<UACFCraftabilityIndex>(this);
+        Found->Initialize(EquipComp, CraftableItems);
+        CraftabilityIndices.Add(Found);
+    }
+    return Found;
 }
 
 /**
@@ -231,7 +274,7 @@ int32 UACFCraftingComponent::GetMaxCraftableAmount(const FACFCraftingRecipe& Rec
  * Starts the crafting process:
  * - Sets count and recipe
  * - Stores instigator and target storage (for sending crafted items)
- * - Starts timer ticking CraftTick every 0.01 seconds
+ * - Records the start time and starts a single timer firing once per crafted item
  */
 void UACFCraftingComponent::StartCrafting(const FACFCraftingRecipe& Recipe, int32 Count, AACFCharacter* InstigatorCharacter, UACFStorageComponent* TargetStorage)
 {
@@ -250,10 +293,13 @@ void UACFCraftingComponent::StartCrafting(const FACFCraftingRecipe& Recipe, int3
         UE_LOG(LogTemp, Error, TEXT("[Crafting] StartCrafting without a valid World"));
         return;
     }
-    
-    RemainingCraftCount = Count;
+    if (Recipe.CraftingTime <= 0.f)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[Crafting] Recipe has non-positive CraftingTime"));
+        return;
+    }
+
     CurrentRecipe = Recipe;
-    CurrentCraftProgress = 0.f;
 
     // Store instigator for later crafting calls
     CraftInstigator = InstigatorCharacter;
@@ -261,101 +307,156 @@ void UACFCraftingComponent::StartCrafting(const FACFCraftingRecipe& Recipe, int3
     // Store target storage (weak ptr to avoid invalid references)
     CurrentTargetStorage = TargetStorage;
 
+    CraftingState.StartTime = GetCraftingWorldTime();
+    CraftingState.CraftDuration = Recipe.CraftingTime;
+    CraftingState.RemainingCount = Count;
+
     bIsCrating = true;  // <-- Set crafting active here
 
-    // Begin timer calling CraftTick repeatedly
-    GetWorld()->GetTimerManager().SetTimer(CraftTimerHandle, this, &UACFCraftingComponent::CraftTick, 0.01f, true);
+    // One looping timer completes an item every CraftingTime seconds, progress is derived from the timestamps
+    GetWorld()->GetTimerManager().SetTimer(CraftTimerHandle, this, &UACFCraftingComponent::HandleCraftCompleted, Recipe.CraftingTime, true);
+    UpdateProgressTimer();
+    OnCraftProgressUpdate.Broadcast(0.f);
 }
 
 /**
  * Nomad Dev Team
  * Cancels any ongoing crafting process immediately.
- * Stops the timer, resets all progress and counters, updates flags,
- * and notifies any listeners (e.g., UI) that crafting has been aborted.
+ * Stops the timers, resets the crafting state and notifies any listeners
+ * (e.g., UI) that crafting has been aborted.
  */
 void UACFCraftingComponent::CancelCrafting()
 {
-    // 1. Stop the recurring timer that was driving CraftTick() calls.
-    //    This prevents any further progress updates or item crafting from occurring.
+    // Stop the timers so no further items will be crafted.
     if (GetWorld())
     {
         GetWorld()->GetTimerManager().ClearTimer(CraftTimerHandle);
+        GetWorld()->GetTimerManager().ClearTimer(CraftProgressTimerHandle);
     }
 
-    // 2. Reset the remaining craft count so no further items will be crafted.
-    RemainingCraftCount = 0;
-
-    // 3. Reset the current progress fraction to zero (0.0 = no progress).
-    CurrentCraftProgress = 0.f;
-
-    // 4. Flip the crafting state flag to false so IsCrafting() reports correctly.
+    CraftingState = FACFCraftingState();
     bIsCrating = false;
 
-    // 5. Notify any bound UI or Blueprint widgets that progress has been reset.
-    //    This ensures the progress bar visually returns to empty.
-    OnCraftProgressUpdate.Broadcast(CurrentCraftProgress);
-
-    // 6. (Optional) Notify listeners that crafting was explicitly canceled.
-    //    You must define this delegate in the header:
-    //      DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCraftCanceled);
-    //      UPROPERTY(BlueprintAssignable) FOnCraftCanceled OnCraftCanceled;
+    // Notify any bound UI that progress has been reset, then that crafting was canceled.
+    OnCraftProgressUpdate.Broadcast(0.f);
     OnCraftCanceled.Broadcast();
 
-    // 7. Log to the console for debugging purposes.
     UE_LOG(LogTemp, Log, TEXT("[UACFCraftingComponent] Crafting cancelled by user or system."));
 }
 
 /**
  * Nomad Dev Team
- * Tick function called on timer:
- * - Increments progress according to crafting time
- * - Broadcasts progress updates
- * - When progress reaches 1.0, completes one craft and resets progress
+ * Called by the completion timer once per item:
  * - Calls ItemsManager::CraftItem passing instigator and storage component
+ * - Moves the start time to the next item, or finishes crafting after the last one
  */
-void UACFCraftingComponent::CraftTick()
+void UACFCraftingComponent::HandleCraftCompleted()
 {
-    // If nothing left to craft, stop timer and broadcast completion
-    if (!bIsCrating || RemainingCraftCount <= 0)
+    if (!bIsCrating || CraftingState.RemainingCount <= 0)
     {
-        if (GetWorld())
-        {
-            GetWorld()->GetTimerManager().ClearTimer(CraftTimerHandle);
-        }
-        bIsCrating = false;
-        OnCraftComplete.Broadcast();
+        FinishCrafting();
         return;
     }
 
-    // Advance progress
-    if (CurrentRecipe.CraftingTime <= 0.f)
+    // Advance by the exact duration so that timer jitter never accumulates
+    CraftingState.StartTime += CraftingState.CraftDuration;
+    CraftingState.RemainingCount--;
+
+    // Get ItemsManager and call CraftItem with storage to store crafted item
+    UACFItemsManagerComponent* ItemsManager = GetItemsManager();
+    if (ItemsManager)
     {
-        UE_LOG(LogTemp, Error, TEXT("[Crafting] Recipe has non-positive CraftingTime"));
-        bIsCrating = false;
-        return;
+        ItemsManager->CraftItem(CurrentRecipe, CraftInstigator.Get(), this, CurrentTargetStorage.Get());
+    }
+
+    // Reset progress broadcast after each item crafted
+    OnCraftProgressUpdate.Broadcast(0.f);
+
+    if (CraftingState.RemainingCount <= 0)
+    {
+        FinishCrafting();
     }
+}
 
-    // Increase progress proportional to crafting speed
-    CurrentCraftProgress += 0.01f / CurrentRecipe.CraftingTime;
+void UACFCraftingComponent::FinishCrafting()
+{
+    if (GetWorld())
+    {
+        GetWorld()->GetTimerManager().ClearTimer(CraftTimerHandle);
+        GetWorld()->GetTimerManager().ClearTimer(CraftProgressTimerHandle);
+    }
+    CraftingState.RemainingCount = 0;
+    bIsCrating = false;
+    OnCraftComplete.Broadcast();
+}
 
-    // Notify UI or listeners of current progress (0 to 1)
-    OnCraftProgressUpdate.Broadcast(CurrentCraftProgress);
+float UACFCraftingComponent::GetCraftingProgress() const
+{
+    if (CraftingState.RemainingCount <= 0 || CraftingState.CraftDuration <= 0.f)
+    {
+        return 0.f;
+    }
+    const double Elapsed = GetCraftingWorldTime() - CraftingState.StartTime;
+    return FMath::Clamp(static_cast<float>(Elapsed / CraftingState.CraftDuration), 0.f, 1.f);
+}
 
-    // If craft finished
-    if (CurrentCraftProgress >= 1.f)
+void UACFCraftingComponent::BroadcastCraftProgress()
+{
+    // Listeners can bind at any time while crafting, so the timer runs regardless and only the broadcast is skipped
+    if (OnCraftProgressUpdate.IsBound())
     {
-        bIsCrating = true;
-        CurrentCraftProgress = 0.f;
-        RemainingCraftCount--;
+        OnCraftProgressUpdate.Broadcast(GetCraftingProgress());
+    }
+}
 
-        // Get ItemsManager and call CraftItem with storage to store crafted item
-        UACFItemsManagerComponent* ItemsManager = GetItemsManager();
-        if (ItemsManager)
+void UACFCraftingComponent::UpdateProgressTimer()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    // Only pay for periodic broadcasts while crafting
+    const bool bShouldBroadcast = CraftingState.RemainingCount > 0 && CraftProgressUpdateInterval > 0.f;
+    if (bShouldBroadcast)
+    {
+        if (!World->GetTimerManager().IsTimerActive(CraftProgressTimerHandle))
         {
-            ItemsManager->CraftItem(CurrentRecipe, CraftInstigator.Get(), this, CurrentTargetStorage.Get());
+            World->GetTimerManager().SetTimer(CraftProgressTimerHandle, this, &UACFCraftingComponent::BroadcastCraftProgress, CraftProgressUpdateInterval, true);
         }
+    }
+    else
+    {
+        World->GetTimerManager().ClearTimer(CraftProgressTimerHandle);
+    }
+}
 
-        // Reset progress broadcast after each item crafted
-        OnCraftProgressUpdate.Broadcast(CurrentCraftProgress);
+double UACFCraftingComponent::GetCraftingWorldTime() const
+{
+    const UWorld* World = GetWorld();
+    if (!World)
+    {
+        return 0.0;
     }
-}
\ No newline at end of file
+    const AGameStateBase* GameState = World->GetGameState();
+    return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+/**
+ * Nomad Dev Team
+ * Clients only receive the timestamps of the craft started on the server and interpolate
+ * the progress locally, the completion is driven by the server timer.
+ */
+void UACFCraftingComponent::OnRep_CraftingState()
+{
+    // A craft driven by this machine owns the state, ignore the server copy
+    if (GetWorld() && GetWorld()->GetTimerManager().IsTimerActive(CraftTimerHandle))
+    {
+        return;
+    }
+
+    bIsCrating = CraftingState.RemainingCount > 0;
+    UpdateProgressTimer();
+    OnCraftProgressUpdate.Broadcast(GetCraftingProgress());
+}
@@ -8,6 +8,8 @@
 #include "Engine/DataTable.h"
 #include "GameplayTagsManager.h"
 #include "ACFBuildableComponent.h"
+#include "ACFLootSubsystem.h"
+#include "Engine/GameInstance.h"
 
 // Sets default values for this component's properties
 UACFItemsManagerComponent::UACFItemsManagerComponent()
@@ -23,6 +25,12 @@ UACFItemsManagerComponent::UACFItemsManagerComponent()
 void UACFItemsManagerComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    // Compiles the loot tables and starts streaming the loot classes before the first roll
+    UACFLootSubsystem* lootSubsystem = GetLootSubsystem();
+    if (lootSubsystem && ItemsDB) {
+        lootSubsystem->IndexItemsDB(ItemsDB);
+    }
 }
 
 bool UACFItemsManagerComponent::GenerateItemsFromRules(const TArray<FACFItemGenerationRule>& generationRules, TArray<FBaseItem>& outItems)
@@ -48,38 +56,110 @@ bool UACFItemsManagerComponent::GenerateItemsFromRules(const TArray<FACFItemGene
 
 bool UACFItemsManagerComponent::GenerateItemFromRule(const FACFItemGenerationRule& generationRules, FBaseItem& outItem)
 {
-    TArray<FItemGenerationSlot> matchingItems;
-    if (ItemsDB) {
-        const auto items = ItemsDB->GetRowMap();
-        for (const auto itemItr : items) {
-            FItemGenerationSlot* itemSlot = (FItemGenerationSlot*)itemItr.Value;
-            if (itemSlot) {
-                if (DoesSlotMatchesRule(generationRules, *itemSlot)) {
-                    matchingItems.Add(*itemSlot);
-                }
+    FItemGenerationSlot selectedSlot;
+    int32 selectedCount = 0;
+    if (!RollRule(generationRules, selectedSlot, selectedCount)) {
+        return false;
+    }
+
+    // Loot classes are preloaded by the loot subsystem, a class still streaming in is not waited for
+    const TSubclassOf<AACFItem> ItemClass = selectedSlot.ItemClass.Get();
+    if (ItemClass) {
+        outItem = FBaseItem(ItemClass, selectedCount);
+        return true;
+    }
+    UE_LOG(LogTemp, Warning, TEXT("Item class is still loading, use GenerateItemFromRuleAsync! - UACFItemsManagerComponent"));
+    return false;
+}
+
+void UACFItemsManagerComponent::GenerateItemsFromRulesAsync(const TArray<FACFItemGenerationRule>& generationRules, TFunction<void(bool, const TArray<FBaseItem>&)> onGenerated)
+{
+    if (generationRules.Num() == 0) {
+        UE_LOG(LogTemp, Warning, TEXT("Missing generation rules! - UACFItemsManagerComponent"));
+        onGenerated(false, TArray<FBaseItem>());
+        return;
+    }
+
+    // Results are kept in rule order and handed over together once the last class is resident
+    struct FPendingGeneration {
+        TArray<FBaseItem> Items;
+        TBitArray<> Generated;
+        int32 Remaining = 0;
+        bool bAllSucceeded = true;
+    };
+    const TSharedRef<FPendingGeneration> pending = MakeShared<FPendingGeneration>();
+    pending->Items.SetNum(generationRules.Num());
+    pending->Generated.Init(false, generationRules.Num());
+    pending->Remaining = generationRules.Num();
+
+    for (int32 index = 0; index < generationRules.Num(); index++) {
+        GenerateItemFromRuleAsync(generationRules[index], [pending, index, onGenerated](bool bSuccess, const FBaseItem& item) {
+            if (bSuccess) {
+                pending->Items[index] = item;
+                pending->Generated[index] = true;
             } else {
-                return false;
+                pending->bAllSucceeded = false;
             }
-        }
 
-        if (matchingItems.Num() == 0) {
-            UE_LOG(LogTemp, Warning, TEXT("No Matching Items in DB! - UACFItemsManagerComponent"));
-            return false;
-        }
-
-        const int32 selectedSlot = FMath::RandRange(0, matchingItems.Num() - 1);
-        const int32 selectedCount = FMath::RandRange(generationRules.MinItemCount, generationRules.MaxItemCount);
-        if (matchingItems.IsValidIndex(selectedSlot) && selectedCount > 0) {
-            const TSubclassOf<AACFItem> ItemClass = matchingItems[selectedSlot].ItemClass.LoadSynchronous();
-            if (ItemClass) {
-                outItem = FBaseItem(ItemClass, selectedCount);
-                return true;
+            if (--pending->Remaining == 0) {
+                TArray<FBaseItem> items;
+                items.Reserve(pending->Items.Num());
+                for (int32 itemIndex = 0; itemIndex < pending->Items.Num(); itemIndex++) {
+                    if (pending->Generated[itemIndex]) {
+                        items.Add(pending->Items[itemIndex]);
+                    }
+                }
+                onGenerated(pending->bAllSucceeded, items);
             }
+        });
+    }
+}
+
+void UACFItemsManagerComponent::GenerateItemFromRuleAsync(const FACFItemGenerationRule& generationRules, TFunction<void(bool, const FBaseItem&)> onGenerated)
+{
+    FItemGenerationSlot selectedSlot;
+    int32 selectedCount = 0;
+    UACFLootSubsystem* lootSubsystem = GetLootSubsystem();
+    if (!lootSubsystem || !RollRule(generationRules, selectedSlot, selectedCount)) {
+        onGenerated(false, FBaseItem());
+        return;
+    }
+
+    lootSubsystem->RequestItemClass(selectedSlot, [selectedCount, onGenerated](TSubclassOf<AACFItem> itemClass) {
+        if (itemClass) {
+            onGenerated(true, FBaseItem(itemClass, selectedCount));
+        } else {
+            onGenerated(false, FBaseItem());
         }
-    } else {
+    });
+}
+
+UACFLootSubsystem* UACFItemsManagerComponent::GetLootSubsystem() const
+{
+    const UGameInstance* gameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+    return gameInstance ? gameInstance->GetSubsystem<UACFLootSubsystem>() : nullptr;
+}
+
+bool UACFItemsManagerComponent::RollRule(const FACFItemGenerationRule& generationRules, FItemGenerationSlot& outSlot, int32& outCount) const
+{
+    if (!ItemsDB) {
         UE_LOG(LogTemp, Error, TEXT("No  ItemsDB! in ItemsManager!!!!- UACFItemsManagerComponent"));
+        return false;
     }
-    return false;
+
+    UACFLootSubsystem* lootSubsystem = GetLootSubsystem();
+    if (!lootSubsystem) {
+        UE_LOG(LogTemp, Error, TEXT("No loot subsystem! - UACFItemsManagerComponent"));
+        return false;
+    }
+
+    if (!lootSubsystem->RollSlot(ItemsDB, generationRules, outSlot)) {
+        UE_LOG(LogTemp, Warning, TEXT("No Matching Items in DB! - UACFItemsManagerComponent"));
+        return false;
+    }
+
+    outCount = FMath::RandRange(generationRules.MinItemCount, generationRules.MaxItemCount);
+    return outCount > 0;
 }
 
 bool UACFItemsManagerComponent::DoesSlotMatchesRule(const FACFItemGenerationRule& generationRules, const FItemGenerationSlot& item)
@@ -156,6 +236,179 @@ void UACFItemsManagerComponent::BuyItems_Implementation(const FBaseItem& item, A
     return;
 }
 
+void UACFItemsManagerComponent::SellItemsToVendorBatch_Implementation(const TArray<FACFVendorSellEntry>& basket, APawn* instigator, UACFVendorComponent* vendorComp)
+{
+    if (!vendorComp || basket.Num() == 0) {
+        return;
+    }
+
+    UACFEquipmentComponent* equipComp = vendorComp->GetPawnEquipment(instigator);
+    UACFCurrencyComponent* currencyComp = vendorComp->GetPawnCurrencyComponent(instigator);
+    UACFCurrencyComponent* vendorCurrency = vendorComp->GetVendorCurrencyComp();
+    if (!equipComp || !currencyComp || (vendorComp->VendorUsesCurrency() && !vendorCurrency)) {
+        return;
+    }
+
+    // Merge the entries of the same stack, so that a basket can't sell the same items twice
+    TMap<FGuid, int32> countsByGuid;
+    for (const FACFVendorSellEntry& entry : basket) {
+        if (entry.Count <= 0) {
+            UE_LOG(LogTemp, Warning, TEXT("Invalid sell count %d - UACFItemsManagerComponent::SellItemsToVendorBatch"), entry.Count);
+            return;
+        }
+        countsByGuid.FindOrAdd(entry.ItemGuid) += entry.Count;
+    }
+
+    // Validate the whole basket against the server inventory before touching anything
+    TArray<TPair<FInventoryItem, int32>> toSell;
+    TArray<FBaseItem> vendorItems;
+    float totalValue = 0.f;
+    for (const auto& it : countsByGuid) {
+        FInventoryItem invItem;
+        if (!equipComp->GetItemByGuid(it.Key, invItem) || invItem.Count < it.Value) {
+            UE_LOG(LogTemp, Warning, TEXT("Not enough items to sell - UACFItemsManagerComponent::SellItemsToVendorBatch"));
+            return;
+        }
+        if (!vendorComp->VendorUsesCurrency() && !invItem.ItemInfo.CurrencyValue) {
+            return;
+        }
+        toSell.Add(TPair<FInventoryItem, int32>(invItem, it.Value));
+        vendorItems.Add(FBaseItem(invItem.ItemClass, it.Value));
+        totalValue += invItem.ItemInfo.CurrencyValue * it.Value * vendorComp->GetVendorPriceMultiplierOnBuy();
+    }
+
+    if (vendorComp->VendorUsesCurrency() && vendorCurrency->GetCurrentCurrencyAmount() < totalValue) {
+        UE_LOG(LogTemp, Warning, TEXT("Vendor can't afford the basket - UACFItemsManagerComponent::SellItemsToVendorBatch"));
+        return;
+    }
+
+    // Everything is validated, apply with a single change per component
+    equipComp->BeginInventoryBatch();
+    for (const auto& sold : toSell) {
+        equipComp->RemoveItem(sold.Key, sold.Value);
+    }
+    equipComp->EndInventoryBatch();
+
+    vendorComp->AddItems(vendorItems);
+    currencyComp->AddCurrency(totalValue);
+    if (vendorComp->VendorUsesCurrency()) {
+        vendorCurrency->RemoveCurrency(totalValue);
+    }
+
+    for (const auto& sold : toSell) {
+        OnItemSold.Broadcast(sold.Key);
+    }
+}
+
+void UACFItemsManagerComponent::BuyItemsBatch_Implementation(const TArray<FBaseItem>& basket, APawn* instigator, UACFVendorComponent* vendorComp)
+{
+    if (!vendorComp || basket.Num() == 0) {
+        return;
+    }
+
+    UACFCurrencyComponent* currencyComp = vendorComp->GetPawnCurrencyComponent(instigator);
+    UACFEquipmentComponent* equipComp = vendorComp->GetPawnEquipment(instigator);
+    if (!currencyComp || !equipComp) {
+        return;
+    }
+
+    // Merge the entries of the same class, so that stock is checked against the whole basket
+    TArray<FBaseItem> toBuy;
+    for (const FBaseItem& item : basket) {
+        if (!item.ItemClass || item.Count <= 0) {
+            UE_LOG(LogTemp, Warning, TEXT("Invalid basket entry - UACFItemsManagerComponent::BuyItemsBatch"));
+            return;
+        }
+        FBaseItem* merged = toBuy.FindByKey(item.ItemClass);
+        if (merged) {
+            merged->Count += item.Count;
+        } else {
+            toBuy.Add(FBaseItem(item.ItemClass, item.Count));
+        }
+    }
+
+    // Validate stock, currency and inventory capacity for the whole basket
+    const TArray<FBaseItem> vendorStock = vendorComp->GetItems();
+    float totalCost = 0.f;
+    float totalWeight = 0.f;
+    int32 stacksNeeded = 0;
+    for (const FBaseItem& item : toBuy) {
+        const FBaseItem* stock = vendorStock.FindByKey(item.ItemClass);
+        FItemDescriptor itemToBuyDesc;
+        if (!stock || stock->Count < item.Count || !vendorComp->TryGetItemDescriptor(item, itemToBuyDesc)) {
+            UE_LOG(LogTemp, Warning, TEXT("Vendor is out of stock - UACFItemsManagerComponent::BuyItemsBatch"));
+            return;
+        }
+        if (itemToBuyDesc.MaxInventoryStack <= 0) {
+            UE_LOG(LogTemp, Warning, TEXT("Invalid max inventory stack - UACFItemsManagerComponent::BuyItemsBatch"));
+            return;
+        }
+        totalCost += itemToBuyDesc.CurrencyValue * item.Count * vendorComp->GetVendorPriceMultiplierOnSell();
+        totalWeight += itemToBuyDesc.ItemWeight * item.Count;
+
+        // Top up the stacks the player already has first, the rest needs new slots
+        int32 remaining = item.Count;
+        TArray<FInventoryItem> ownedStacks;
+        equipComp->GetAllItemsOfClassInInventory(item.ItemClass, ownedStacks);
+        for (const FInventoryItem& owned : ownedStacks) {
+            remaining -= FMath::Clamp(itemToBuyDesc.MaxInventoryStack - owned.Count, 0, remaining);
+        }
+        stacksNeeded += FMath::DivideAndRoundUp(remaining, itemToBuyDesc.MaxInventoryStack);
+    }
+
+    if (currencyComp->GetCurrentCurrencyAmount() < totalCost) {
+        UE_LOG(LogTemp, Warning, TEXT("Not enough currency for the basket - UACFItemsManagerComponent::BuyItemsBatch"));
+        return;
+    }
+
+    const int32 freeSlots = equipComp->GetMaxInventorySlots() - equipComp->GetInventory().Num();
+    if (stacksNeeded > freeSlots || equipComp->GetCurrentInventoryTotalWeight() + totalWeight > equipComp->GetMaxInventoryWeight()) {
+        UE_LOG(LogTemp, Warning, TEXT("Inventory can't take the whole basket - UACFItemsManagerComponent::BuyItemsBatch"));
+        return;
+    }
+
+    // Remember every stack before adding, so a partial add can be undone on exactly the stacks it touched
+    TMap<FGuid, int32> stackCountsBefore;
+    for (const FInventoryItem& invItem : equipComp->GetInventory()) {
+        stackCountsBefore.Add(invItem.GetItemGuid(), invItem.Count);
+    }
+
+    equipComp->BeginInventoryBatch();
+    bool bAllAdded = true;
+    for (const FBaseItem& item : toBuy) {
+        const int32 countBefore = equipComp->GetTotalCountOfItemsByClass(item.ItemClass);
+        equipComp->AddItemToInventory(item);
+        if (equipComp->GetTotalCountOfItemsByClass(item.ItemClass) - countBefore < item.Count) {
+            bAllAdded = false;
+            break;
+        }
+    }
+
+    if (!bAllAdded) {
+        for (const FInventoryItem& invItem : equipComp->GetInventory()) {
+            const int32* countBefore = stackCountsBefore.Find(invItem.GetItemGuid());
+            const int32 addedCount = invItem.Count - (countBefore ? *countBefore : 0);
+            if (addedCount > 0) {
+                equipComp->RemoveItem(invItem, addedCount);
+            }
+        }
+        equipComp->EndInventoryBatch();
+        UE_LOG(LogTemp, Warning, TEXT("Inventory can't take the whole basket, rolled back - UACFItemsManagerComponent::BuyItemsBatch"));
+        return;
+    }
+    equipComp->EndInventoryBatch();
+
+    vendorComp->RemoveItems(toBuy);
+    currencyComp->RemoveCurrency(totalCost);
+    if (vendorComp->GetVendorCurrencyComp()) {
+        vendorComp->GetVendorCurrencyComp()->AddCurrency(totalCost);
+    }
+
+    for (const FBaseItem& item : toBuy) {
+        OnItemPurchased.Broadcast(item);
+    }
+}
+
 /**
  * Nomad Dev Team
  * Server‐side RPC handler for crafting an item, consuming resources, and
@@ -238,6 +491,54 @@ void UACFItemsManagerComponent::CraftItem_Implementation(
         *ItemToCraft.OutputItem.ItemClass->GetName());
 }
 
+void UACFItemsManagerComponent::QueueCraftItem_Implementation(
+    const FACFCraftingRecipe& ItemToCraft,
+    int32 Count,
+    APawn* instigator,
+    UACFCraftingComponent* craftingComp)
+{
+    if (!craftingComp || !instigator || Count <= 0)
+    {
+        UE_LOG(LogTemp, Warning,
+            TEXT("[UACFItemsManagerComponent::QueueCraftItem] Invalid craftingComp (%s), instigator (%s) or count (%d)"),
+            *GetNameSafe(craftingComp), *GetNameSafe(instigator), Count);
+        return;
+    }
+
+    UACFEquipmentComponent* equipComp = craftingComp->GetPawnEquipment(instigator);
+    UACFCurrencyComponent* currencyComp = craftingComp->GetPawnCurrencyComponent(instigator);
+    if (!equipComp || !currencyComp)
+    {
+        UE_LOG(LogTemp, Error,
+            TEXT("[UACFItemsManagerComponent::QueueCraftItem] Missing Equipment or Currency component on '%s'"),
+            *instigator->GetName());
+        return;
+    }
+
+    // Validate resources and currency for the whole batch before touching anything
+    const float Cost = craftingComp->GetVendorPriceMultiplierOnSell() * ItemToCraft.CraftingCost * Count;
+    if (craftingComp->GetMaxCraftableAmount(ItemToCraft, instigator) < Count || currencyComp->GetCurrentCurrencyAmount() < Cost)
+    {
+        UE_LOG(LogTemp, Warning,
+            TEXT("[UACFItemsManagerComponent::QueueCraftItem] Pawn '%s' cannot craft %d x recipe '%s'"),
+            *instigator->GetName(), Count, *GetNameSafe(ItemToCraft.OutputItem.ItemClass));
+        return;
+    }
+
+    if (!craftingComp->EnqueueCraft(ItemToCraft, Count, instigator))
+    {
+        return;
+    }
+
+    TArray<FBaseItem> requiredItems = ItemToCraft.RequiredItems;
+    for (FBaseItem& required : requiredItems)
+    {
+        required.Count *= Count;
+    }
+    currencyComp->RemoveCurrency(Cost);
+    equipComp->ConsumeItems(requiredItems);
+}
+
 void UACFItemsManagerComponent::UpgradeItem_Implementation(const FInventoryItem& itemToUpgrade, APawn* instigator, class UACFCraftingComponent* craftingComp)
 {
     if (!craftingComp) {
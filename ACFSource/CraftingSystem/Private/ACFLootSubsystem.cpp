@@ -0,0 +1,201 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFLootSubsystem.h"
+#include "Engine/AssetManager.h"
+#include "Engine/DataTable.h"
+#include "Engine/StreamableManager.h"
+#include "GameplayTagsManager.h"
+#include "Items/ACFItem.h"
+
+void FACFLootAliasTable::Build(const TArray<int32>& slots, const TArray<float>& weights)
+{
+    Slots.Reset();
+    Probabilities.Reset();
+    Aliases.Reset();
+
+    float totalWeight = 0.f;
+    for (int32 i = 0; i < slots.Num(); i++) {
+        if (weights[i] > 0.f) {
+            Slots.Add(slots[i]);
+            Probabilities.Add(weights[i]);
+            totalWeight += weights[i];
+        }
+    }
+
+    const int32 num = Slots.Num();
+    if (num == 0) {
+        return;
+    }
+
+    // Vose's method: split the scaled weights in under and over full buckets and pair them
+    Aliases.Init(INDEX_NONE, num);
+    TArray<int32> underFull;
+    TArray<int32> overFull;
+    for (int32 i = 0; i < num; i++) {
+        Probabilities[i] *= num / totalWeight;
+        if (Probabilities[i] < 1.f) {
+            underFull.Add(i);
+        } else {
+            overFull.Add(i);
+        }
+    }
+
+    while (underFull.Num() > 0 && overFull.Num() > 0) {
+        const int32 less = underFull.Pop();
+        const int32 more = overFull.Pop();
+        Aliases[less] = more;
+        Probabilities[more] = (Probabilities[more] + Probabilities[less]) - 1.f;
+        if (Probabilities[more] < 1.f) {
+            underFull.Add(more);
+        } else {
+            overFull.Add(more);
+        }
+    }
+
+    // Leftovers are full buckets, only off by rounding errors
+    for (const int32 i : underFull) {
+        Probabilities[i] = 1.f;
+    }
+    for (const int32 i : overFull) {
+        Probabilities[i] = 1.f;
+    }
+}
+
+int32 FACFLootAliasTable::Sample() const
+{
+    if (Slots.Num() == 0) {
+        return INDEX_NONE;
+    }
+    const int32 bucket = FMath::RandRange(0, Slots.Num() - 1);
+    const int32 picked = FMath::FRand() < Probabilities[bucket] ? bucket : Aliases[bucket];
+    return Slots[picked];
+}
+
+void UACFLootSubsystem::Deinitialize()
+{
+    for (auto& it : indexedDBs) {
+        if (it.Value.PreloadHandle.IsValid()) {
+            it.Value.PreloadHandle->ReleaseHandle();
+        }
+    }
+    indexedDBs.Empty();
+    Super::Deinitialize();
+}
+
+void UACFLootSubsystem::IndexItemsDB(const UDataTable* itemsDB)
+{
+    FindOrBuildIndex(itemsDB);
+}
+
+void UACFLootSubsystem::InvalidateItemsDB(const UDataTable* itemsDB)
+{
+    FACFLootDBIndex* index = indexedDBs.Find(const_cast<UDataTable*>(itemsDB));
+    if (index && index->PreloadHandle.IsValid()) {
+        index->PreloadHandle->ReleaseHandle();
+    }
+    indexedDBs.Remove(const_cast<UDataTable*>(itemsDB));
+}
+
+bool UACFLootSubsystem::RollSlot(const UDataTable* itemsDB, const FACFItemGenerationRule& rule, FItemGenerationSlot& outSlot)
+{
+    FACFLootDBIndex* index = FindOrBuildIndex(itemsDB);
+    if (!index) {
+        return false;
+    }
+
+    const int32 slotIndex = FindOrBuildTable(*index, rule.Category, rule.Rarity).Sample();
+    if (!index->Slots.IsValidIndex(slotIndex)) {
+        return false;
+    }
+    outSlot = index->Slots[slotIndex];
+    return true;
+}
+
+void UACFLootSubsystem::RequestItemClass(const FItemGenerationSlot& slot, TFunction<void(TSubclassOf<AACFItem>)> onLoaded)
+{
+    if (slot.ItemClass.IsNull()) {
+        onLoaded(nullptr);
+        return;
+    }
+
+    UClass* residentClass = slot.ItemClass.Get();
+    if (residentClass || !UAssetManager::IsInitialized()) {
+        onLoaded(residentClass ? residentClass : slot.ItemClass.LoadSynchronous());
+        return;
+    }
+
+    const TSoftClassPtr<AACFItem> itemClass = slot.ItemClass;
+    UAssetManager::GetStreamableManager().RequestAsyncLoad(itemClass.ToSoftObjectPath(),
+        FStreamableDelegate::CreateLambda([itemClass, onLoaded]() {
+            onLoaded(itemClass.Get());
+        }));
+}
+
+FACFLootDBIndex* UACFLootSubsystem::FindOrBuildIndex(const UDataTable* itemsDB)
+{
+    if (!itemsDB) {
+        return nullptr;
+    }
+
+    UDataTable* dbKey = const_cast<UDataTable*>(itemsDB);
+    FACFLootDBIndex* existingIndex = indexedDBs.Find(dbKey);
+    if (existingIndex) {
+        return existingIndex;
+    }
+
+    FACFLootDBIndex& newIndex = indexedDBs.Add(dbKey);
+    newIndex.Slots.Reserve(itemsDB->GetRowMap().Num());
+    TArray<FSoftObjectPath> lootClasses;
+    for (const auto& it : itemsDB->GetRowMap()) {
+        const FItemGenerationSlot* itemSlot = (const FItemGenerationSlot*)(it.Value);
+        if (!itemSlot) {
+            continue;
+        }
+        const int32 slotIndex = newIndex.Slots.Add(*itemSlot);
+        newIndex.SlotsByCategoryAndRarity.FindOrAdd(TPair<FGameplayTag, FGameplayTag>(itemSlot->Category, itemSlot->Rarity)).Add(slotIndex);
+        if (!itemSlot->ItemClass.IsNull()) {
+            lootClasses.AddUnique(itemSlot->ItemClass.ToSoftObjectPath());
+        }
+    }
+
+    // Rules usually target the exact pairs of the DB, compile them upfront
+    TArray<TPair<FGameplayTag, FGameplayTag>> exactPairs;
+    newIndex.SlotsByCategoryAndRarity.GenerateKeyArray(exactPairs);
+    for (const TPair<FGameplayTag, FGameplayTag>& pair : exactPairs) {
+        FindOrBuildTable(newIndex, pair.Key, pair.Value);
+    }
+
+    if (lootClasses.Num() > 0 && UAssetManager::IsInitialized()) {
+        newIndex.PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(lootClasses, FStreamableDelegate(), FStreamableManager::AsyncLoadLowPriority);
+    }
+    return &newIndex;
+}
+
+const FACFLootAliasTable& UACFLootSubsystem::FindOrBuildTable(FACFLootDBIndex& index, const FGameplayTag& category, const FGameplayTag& rarity)
+{
+    const TPair<FGameplayTag, FGameplayTag> key(category, rarity);
+    const FACFLootAliasTable* existingTable = index.Tables.Find(key);
+    if (existingTable) {
+        return *existingTable;
+    }
+
+    // Same matching as UACFItemsManagerComponent::DoesSlotMatchesRule, evaluated once per group instead of per row
+    const FGameplayTagContainer categoryChildren = UGameplayTagsManager::Get().RequestGameplayTagChildren(category);
+    const FGameplayTagContainer rarityChildren = UGameplayTagsManager::Get().RequestGameplayTagChildren(rarity);
+    TArray<int32> slots;
+    TArray<float> weights;
+    for (const auto& group : index.SlotsByCategoryAndRarity) {
+        const bool bCategoryMatches = group.Key.Key == category || categoryChildren.HasTag(group.Key.Key);
+        const bool bRarityMatches = group.Key.Value == rarity || rarityChildren.HasTag(group.Key.Value);
+        if (bCategoryMatches && bRarityMatches) {
+            for (const int32 slotIndex : group.Value) {
+                slots.Add(slotIndex);
+                weights.Add(index.Slots[slotIndex].Weight);
+            }
+        }
+    }
+
+    FACFLootAliasTable& newTable = index.Tables.Add(key);
+    newTable.Build(slots, weights);
+    return newTable;
+}
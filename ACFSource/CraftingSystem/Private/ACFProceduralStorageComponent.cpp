@@ -8,17 +8,26 @@
 
 void UACFProceduralStorageComponent::GenerateStorageItems_Implementation()
 {
-	if (bGenerated) {
+	if (bGenerated || bGenerationPending) {
 		return;
 	}
 	UACFItemsManagerComponent* itemsManager = GetItemsManager();
 	if (itemsManager) {
-		TArray<FBaseItem> items;
-		if (!itemsManager->GenerateItemsFromRules(ItemGenerationRules, items)) {
-			UE_LOG(LogTemp, Warning, TEXT("Something went wrong in items generation! - UACFProceduralStorageComponent"));
-		}
-		bGenerated = true;
-		AddItems(items);
+		// Items are added all together once their classes are resident, without blocking on loads.
+		// The storage is only marked as generated then, so a save in between regenerates it on load
+		bGenerationPending = true;
+		TWeakObjectPtr<UACFProceduralStorageComponent> weakThis = this;
+		itemsManager->GenerateItemsFromRulesAsync(ItemGenerationRules, [weakThis](bool bAllSucceeded, const TArray<FBaseItem>& items) {
+			if (!bAllSucceeded) {
+				UE_LOG(LogTemp, Warning, TEXT("Something went wrong in items generation! - UACFProceduralStorageComponent"));
+			}
+			UACFProceduralStorageComponent* storage = weakThis.Get();
+			if (storage) {
+				storage->bGenerationPending = false;
+				storage->bGenerated = true;
+				storage->AddItems(items);
+			}
+		});
 	}
 	else {
 		UE_LOG(LogTemp, Error, TEXT("No Items manager in your game state! - UACFProceduralStorageComponent"));
@@ -125,6 +125,22 @@ void UACFVendorComponent::SellItemsToVendor(const FInventoryItem& itemTobeSold,
     }
 }
 
+// Function to handle buying a whole basket from the vendor
+void UACFVendorComponent::BuyItemsBatch(const TArray<FBaseItem>& basket, APawn* instigator)
+{
+    if (GetItemsManager()) {
+        GetItemsManager()->BuyItemsBatch(basket, instigator, this);
+    }
+}
+
+// Function to handle selling a whole basket to the vendor
+void UACFVendorComponent::SellItemsToVendorBatch(const TArray<FACFVendorSellEntry>& basket, APawn* instigator)
+{
+    if (GetItemsManager()) {
+        GetItemsManager()->SellItemsToVendorBatch(basket, instigator, this);
+    }
+}
+
 /*-------------------PLAYER STUFF-----------------------------------*/
 
 // Get the items manager component
@@ -0,0 +1,72 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ACFCraftRecipeDataAsset.h"
+#include "Components/ACFEquipmentComponent.h"
+#include "Items/ACFItem.h"
+#include "UObject/Object.h"
+
+#include "ACFCraftabilityIndex.generated.h"
+
+/**
+ * Nomad Dev Team
+ * Craftability of a recipe list for a single player.
+ * Keeps the player's item counts by class, updated with the added/removed deltas of the inventory,
+ * and re-evaluates only the recipes whose ingredients changed since the last query.
+ */
+UCLASS()
+class CRAFTINGSYSTEM_API UACFCraftabilityIndex : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    // Binds to the equipment inventory events and indexes the recipes by ingredient.
+    void Initialize(UACFEquipmentComponent* InEquipment, const TArray<FACFCraftingRecipe>& Recipes);
+
+    // Re-indexes the recipes, to be called whenever the recipe list changes.
+    void SetRecipes(const TArray<FACFCraftingRecipe>& Recipes);
+
+    UACFEquipmentComponent* GetEquipment() const { return Equipment.Get(); }
+
+    // Cached total count of the given class in the player inventory.
+    int32 GetItemCount(const TSubclassOf<AACFItem>& ItemClass) const;
+
+    // How many times the recipe can be crafted with the cached counts, works for recipes outside the indexed list too.
+    int32 ComputeMaxCraftableAmount(const FACFCraftingRecipe& Recipe) const;
+
+    // Max craftable amount of the recipe at RecipeIndex in the indexed list, re-evaluated only if its ingredients changed.
+    int32 GetMaxCraftableAmount(int32 RecipeIndex);
+
+private:
+    UFUNCTION()
+    void HandleItemAdded(const FBaseItem& Item);
+
+    UFUNCTION()
+    void HandleItemRemoved(const FBaseItem& Item);
+
+    UFUNCTION()
+    void HandleInventoryReloaded(const TArray<FInventoryItem>& Inventory);
+
+    // Applies a count delta of one class and dirties the recipes using it.
+    void ApplyItemDelta(const TSubclassOf<AACFItem>& ItemClass, int32 Delta);
+
+    // Full recount, only for inventories replaced without add/remove events.
+    void RecountItems(const TArray<FInventoryItem>& Inventory);
+
+    void DirtyRecipesUsing(const TSubclassOf<AACFItem>& ItemClass);
+
+    TWeakObjectPtr<UACFEquipmentComponent> Equipment;
+
+    // Total count per item class in the player inventory
+    TMap<TSubclassOf<AACFItem>, int32> ItemCounts;
+
+    // Indices of the recipes that require each class
+    TMap<TSubclassOf<AACFItem>, TArray<int32>> RecipesByIngredient;
+
+    // Indexed recipes, their cached max craftable amount and whether it must be re-evaluated
+    TArray<FACFCraftingRecipe> IndexedRecipes;
+    TArray<int32> MaxCraftableAmounts;
+    TBitArray<> DirtyRecipes;
+};
@@ -10,6 +10,7 @@
 #include "ACFCraftingComponent.generated.h" // Unreal reflection system header for this class.
 
 class AACFCharacter; // Forward declare player character class.
+class UACFCraftabilityIndex; // Forward declare per-player craftability cache.
 class UCraftingStationData; // Forward declare crafting station data class.
 
 // Delegate that broadcasts a float progress value from 0.0 to 1.0
@@ -22,6 +23,30 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCraftCanceled);
 // Forward declaration for craft recipe data asset class
 class UACFCraftRecipeDataAsset;
 
+/**
+ * FACFCraftingState
+ * Timestamp based description of the running craft, replicated so that clients
+ * can interpolate the progress locally instead of receiving progress updates.
+ */
+USTRUCT(BlueprintType)
+struct FACFCraftingState
+{
+    GENERATED_BODY()
+
+public:
+    /** Server world time at which the item currently in progress was started. */
+    UPROPERTY(BlueprintReadOnly, Category = "Crafting")
+    double StartTime = 0.0;
+
+    /** Seconds required to craft one item. */
+    UPROPERTY(BlueprintReadOnly, Category = "Crafting")
+    float CraftDuration = 0.f;
+
+    /** Items left to craft, including the one in progress. */
+    UPROPERTY(BlueprintReadOnly, Category = "Crafting")
+    int32 RemainingCount = 0;
+};
+
 /**
  * UACFCraftingComponent
  * Handles crafting and upgrading items.
@@ -111,6 +136,7 @@ public:
     void AddNewRecipe(const FACFCraftingRecipe& recipe)
     {
         CraftableItems.Add(recipe);
+        MarkRecipesChanged();
     }
 
     /**
@@ -130,13 +156,29 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Crafting")
     void CancelCrafting();
 
-    // Function called every tick of the crafting timer to update progress and complete crafts.
-    void CraftTick();
+    /**
+     * Nomad Dev Team
+     * SERVER: queues Count crafts of the recipe. Resources are consumed by the caller only if this returns true.
+     * The base component has no queue and always refuses.
+     */
+    virtual bool EnqueueCraft(const FACFCraftingRecipe& Recipe, int32 Count, APawn* InstigatorPawn) { return false; }
 
     // Returns true if currently crafting.
     UFUNCTION(BlueprintCallable, Category = "Crafting")
     bool IsCrafting() { return bIsCrating; };
 
+    /**
+     * Nomad Dev Team
+     * Progress [0..1] of the item currently in progress, interpolated from the crafting state.
+     * Cheap enough to be polled by UI every frame.
+     */
+    UFUNCTION(BlueprintPure, Category = "Crafting")
+    float GetCraftingProgress() const;
+
+    // Returns the timestamp based state of the running craft.
+    UFUNCTION(BlueprintPure, Category = "Crafting")
+    FACFCraftingState GetCraftingState() const { return CraftingState; }
+
     /**
      * Nomad Dev Team
      * Calculates max craftable amount of given recipe based on pawn inventory.
@@ -145,7 +187,15 @@ public:
      * @return Max number of times the recipe can be crafted.
      */
     UFUNCTION(BlueprintCallable, Category = "ACF | Crafting")
-    int32 GetMaxCraftableAmount(const FACFCraftingRecipe& Recipe, const APawn* Pawn) const;
+    int32 GetMaxCraftableAmount(const FACFCraftingRecipe& Recipe, const APawn* Pawn);
+
+    /**
+     * Nomad Dev Team
+     * Returns the recipes the pawn has enough ingredients and currency to craft right now.
+     * Evaluated against the pawn's cached item counts, only recipes whose ingredients changed are re-evaluated.
+     */
+    UFUNCTION(BlueprintCallable, Category = "ACF | Crafting")
+    TArray<FACFCraftingRecipe> GetCraftableNowRecipes(const APawn* Pawn);
 
     // Nomad Dev Team - Delegate to broadcast progress updates to Blueprint/UI
     UPROPERTY(BlueprintAssignable, Category = "Crafting | Delegates")
@@ -167,19 +217,57 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACF)
     TArray<UACFCraftRecipeDataAsset*> ItemsRecipes;
 
+    /**
+     * Nomad Dev Team
+     * Seconds between OnCraftProgressUpdate broadcasts while crafting.
+     * The timer only runs while crafting, each tick is skipped if nothing is bound. Set to 0 to disable it.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crafting", meta = (ClampMin = 0.f))
+    float CraftProgressUpdateInterval = 0.1f;
+
     // Array holding all crafting recipes available at runtime.
     UPROPERTY()
     TArray<FACFCraftingRecipe> CraftableItems;
 
+    // Nomad Dev Team - Must be called after editing CraftableItems directly so that craftability caches re-index the recipes.
+    void MarkRecipesChanged() { bCraftabilityRecipesDirty = true; }
+
 private:
     /**
      * Nomad Dev Team
      */
-    int32 RemainingCraftCount = 0;          // Number of crafts left to process
-    float CurrentCraftProgress = 0.f;       // Current progress [0..1]
+    UPROPERTY(ReplicatedUsing = OnRep_CraftingState)
+    FACFCraftingState CraftingState;        // Start time, duration and remaining count of the running craft
+
+    UFUNCTION()
+    void OnRep_CraftingState();
+
+    // Called once per crafted item by the completion timer.
+    void HandleCraftCompleted();
+
+    // Broadcasts the interpolated progress at CraftProgressUpdateInterval.
+    void BroadcastCraftProgress();
+
+    // Starts or stops the progress broadcast timer according to the crafting state.
+    void UpdateProgressTimer();
+
+    // Server world time, shared by server and clients to interpolate the progress.
+    double GetCraftingWorldTime() const;
+
+    void FinishCrafting();
+
+    // Returns the craftability cache of the pawn, created on first use.
+    UACFCraftabilityIndex* GetCraftabilityIndex(const APawn* Pawn);
+
+    // Nomad Dev Team: One craftability cache per player that queried this station
+    UPROPERTY()
+    TArray<TObjectPtr<UACFCraftabilityIndex>> CraftabilityIndices;
+    bool bCraftabilityRecipesDirty = false;
+
     bool bIsCrating = false;                 // Flag: Is crafting active
     FACFCraftingRecipe CurrentRecipe;       // Recipe currently being crafted
-    FTimerHandle CraftTimerHandle;          // Timer handle for CraftTick callback
+    FTimerHandle CraftTimerHandle;          // Timer handle for the per-item completion
+    FTimerHandle CraftProgressTimerHandle;  // Timer handle for the opt-in progress broadcast
     UPROPERTY()
     TObjectPtr<AACFCharacter> CraftInstigator = nullptr; // Pointer to instigator character
 
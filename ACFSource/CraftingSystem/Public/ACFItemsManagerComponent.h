@@ -4,6 +4,7 @@
 
 #include "ACFCraftRecipeDataAsset.h"
 #include "ACFItemTypes.h"
+#include "ACFVendorComponent.h"
 #include "Components/ACFEquipmentComponent.h"
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
@@ -37,6 +38,12 @@ protected:
     UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = ACF)
     UDataTable* ItemsDB;
 
+private:
+    class UACFLootSubsystem* GetLootSubsystem() const;
+
+    /* Rolls the slot and count of a rule, false if nothing can be generated*/
+    bool RollRule(const FACFItemGenerationRule& generationRules, FItemGenerationSlot& outSlot, int32& outCount) const;
+
 public:
     /* Generates an array of FBaseItem matching the provided rules by selecting them from the provided ItemsDB
     returns true only if we are able to find matching items for ALL the provided rules*/
@@ -44,10 +51,19 @@ public:
     bool GenerateItemsFromRules(const TArray<FACFItemGenerationRule>& generationRules, TArray<FBaseItem>& outItems);
 
     /* Generates an  FBaseItem matching the provide rule by selecting it from the provided ItemsDB
-    returns true if at least one item is found*/
+    returns true if at least one item is found. Never loads: returns false if the rolled class is still
+    streaming in, use GenerateItemFromRuleAsync to wait for it*/
     UFUNCTION(BlueprintCallable, Category = ACF)
     bool GenerateItemFromRule(const FACFItemGenerationRule& generationRules, FBaseItem& outItems);
 
+    /* Same as GenerateItemFromRule, but never loads the item class synchronously: onGenerated is called
+    right away if the class is resident, once it is streamed in otherwise*/
+    void GenerateItemFromRuleAsync(const FACFItemGenerationRule& generationRules, TFunction<void(bool, const FBaseItem&)> onGenerated);
+
+    /* Async version of GenerateItemsFromRules: onGenerated is called once, when the items of all the
+    rules are resident, with false if any rule failed*/
+    void GenerateItemsFromRulesAsync(const TArray<FACFItemGenerationRule>& generationRules, TFunction<void(bool, const TArray<FBaseItem>&)> onGenerated);
+
     /* Returns true if the provided itemSlot matches the provided slot rules*/
     UFUNCTION(BlueprintCallable, Category = ACF)
     bool DoesSlotMatchesRule(const FACFItemGenerationRule& generationRules, const FItemGenerationSlot& item);
@@ -59,6 +75,24 @@ public:
     UFUNCTION(Server, Reliable)
     void SellItemsToVendor(const FInventoryItem& itemTobeSold, APawn* instigator, int32 count, class UACFVendorComponent* vendorComp);
 
+    /**
+     * Nomad Dev Team
+     * Server‐side RPC selling a whole basket in a single transaction. The basket is validated as a whole
+     * against the server inventory and the vendor currency, then applied with one change event per component.
+     * Nothing is sold if any entry is invalid.
+     */
+    UFUNCTION(Server, Reliable)
+    void SellItemsToVendorBatch(const TArray<FACFVendorSellEntry>& basket, APawn* instigator, class UACFVendorComponent* vendorComp);
+
+    /**
+     * Nomad Dev Team
+     * Server‐side RPC buying a whole basket in a single transaction. The basket is validated as a whole
+     * against the vendor stock and the buyer currency; if the inventory can't take every item the
+     * added items are rolled back and nothing is bought.
+     */
+    UFUNCTION(Server, Reliable)
+    void BuyItemsBatch(const TArray<FBaseItem>& basket, APawn* instigator, class UACFVendorComponent* vendorComp);
+
     /**
      * Nomad Dev Team
      * Server‐side RPC handler for crafting an item, consuming resources, and
@@ -68,6 +102,14 @@ public:
     UFUNCTION(Server, Reliable)
     void CraftItem(const FACFCraftingRecipe& ItemToCraft, APawn* instigator, UACFCraftingComponent* craftingComp, UACFStorageComponent* TargetStorage);
 
+    /**
+     * Nomad Dev Team
+     * Server‐side RPC that consumes the resources of Count crafts at once and hands them to
+     * the crafting component queue, which completes them over time even while unloaded.
+     */
+    UFUNCTION(Server, Reliable)
+    void QueueCraftItem(const FACFCraftingRecipe& ItemToCraft, int32 Count, APawn* instigator, UACFCraftingComponent* craftingComp);
+
     UFUNCTION(Server, Reliable)
     void UpgradeItem(const FInventoryItem& itemToUpgrade, APawn* instigator, class UACFCraftingComponent* craftingComp);
 
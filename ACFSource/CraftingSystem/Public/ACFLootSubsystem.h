@@ -0,0 +1,87 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "ACFItemTypes.h"
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include <GameplayTagContainer.h>
+
+#include "ACFLootSubsystem.generated.h"
+
+class UDataTable;
+struct FStreamableHandle;
+
+/*Walker's alias table over the slots of an items DB: samples a weighted slot in O(1)*/
+USTRUCT()
+struct FACFLootAliasTable {
+    GENERATED_BODY()
+
+public:
+    /*Builds the table from the provided slot indices and their weights*/
+    void Build(const TArray<int32>& slots, const TArray<float>& weights);
+
+    /*Returns the index of the sampled slot in the DB, INDEX_NONE if the table is empty*/
+    int32 Sample() const;
+
+    bool IsEmpty() const { return Slots.Num() == 0; }
+
+private:
+    TArray<int32> Slots;
+    TArray<float> Probabilities;
+    TArray<int32> Aliases;
+};
+
+/*Compiled loot tables of a single items DB*/
+USTRUCT()
+struct FACFLootDBIndex {
+    GENERATED_BODY()
+
+public:
+    /*Rows of the DB, in row map order*/
+    TArray<FItemGenerationSlot> Slots;
+
+    /*Slot indices grouped by their exact category and rarity*/
+    TMap<TPair<FGameplayTag, FGameplayTag>, TArray<int32>> SlotsByCategoryAndRarity;
+
+    /*Alias tables by rule category and rarity, compiled at startup for the exact pairs of the DB and on
+    first use for parent tags*/
+    TMap<TPair<FGameplayTag, FGameplayTag>, FACFLootAliasTable> Tables;
+
+    /*Keeps every loot class resident once streamed in*/
+    TSharedPtr<FStreamableHandle> PreloadHandle;
+};
+
+/**
+ * Compiles the items DBs used for loot generation into weighted alias tables, so that
+ * rolling a loot rule doesn't scan the DB, and streams the loot classes in asynchronously
+ */
+UCLASS()
+class CRAFTINGSYSTEM_API UACFLootSubsystem : public UGameInstanceSubsystem {
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    /*Compiles the provided DB and starts streaming its loot classes if it wasn't done yet*/
+    UFUNCTION(BlueprintCallable, Category = ACF)
+    void IndexItemsDB(const UDataTable* itemsDB);
+
+    /*Drops the compiled tables of the provided DB, they will be rebuilt on the next roll*/
+    UFUNCTION(BlueprintCallable, Category = ACF)
+    void InvalidateItemsDB(const UDataTable* itemsDB);
+
+    /*Picks a slot of the DB matching the rule. Returns false if no slot matches*/
+    bool RollSlot(const UDataTable* itemsDB, const FACFItemGenerationRule& rule, FItemGenerationSlot& outSlot);
+
+    /*Calls onLoaded with the class of the slot, right away if it is resident, once streamed in otherwise*/
+    void RequestItemClass(const FItemGenerationSlot& slot, TFunction<void(TSubclassOf<class AACFItem>)> onLoaded);
+
+private:
+    FACFLootDBIndex* FindOrBuildIndex(const UDataTable* itemsDB);
+
+    const FACFLootAliasTable& FindOrBuildTable(FACFLootDBIndex& index, const FGameplayTag& category, const FGameplayTag& rarity);
+
+    UPROPERTY()
+    TMap<TObjectPtr<UDataTable>, FACFLootDBIndex> indexedDBs;
+};
@@ -29,4 +29,7 @@ protected:
 private:
     UPROPERTY(SaveGame)
     bool bGenerated = false;
+
+    /*Items are being rolled, set until all of them are added*/
+    bool bGenerationPending = false;
 };
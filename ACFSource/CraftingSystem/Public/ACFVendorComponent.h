@@ -12,6 +12,25 @@
 class UACFCurrencyComponent;
 class UACFItemsManagerComponent;
 
+/*An inventory item to be sold in a vendor basket*/
+USTRUCT(BlueprintType)
+struct FACFVendorSellEntry {
+    GENERATED_BODY()
+
+public:
+    FACFVendorSellEntry() {};
+
+    FACFVendorSellEntry(const FGuid& inItemGuid, int32 inCount)
+        : ItemGuid(inItemGuid)
+        , Count(inCount) {};
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACF)
+    FGuid ItemGuid;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACF)
+    int32 Count = 1;
+};
+
 /**
  * This class represents a vendor component that can manage buying and selling items with players.
  */
@@ -51,6 +70,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "ACF | Vendor")
     void SellItemsToVendor(const FInventoryItem& itemTobeSold, APawn* instigator, int32 count = 1);
 
+    // Buy a whole basket in a single transaction, nothing is bought if any item can't be
+    UFUNCTION(BlueprintCallable, Category = "ACF | Vendor")
+    void BuyItemsBatch(const TArray<FBaseItem>& basket, APawn* instigator);
+
+    // Sell a whole basket in a single transaction, nothing is sold if any item can't be
+    UFUNCTION(BlueprintCallable, Category = "ACF | Vendor")
+    void SellItemsToVendorBatch(const TArray<FACFVendorSellEntry>& basket, APawn* instigator);
+
     /*-------------------PLAYER STUFF-----------------------------------*/
 
     // Get the items manager component from the player controller
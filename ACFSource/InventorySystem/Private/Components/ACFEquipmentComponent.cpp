@@ -123,6 +123,9 @@ void UACFEquipmentComponent::OnComponentLoaded_Implementation()
     UpdateEquippedItemsVisibility();
     // Update the total weight value for the inventory.
     RefreshTotalWeight();
+    // The loaded inventory replaced the previous one without any add/remove event, let listeners rebuild their caches.
+    OnInventoryReloaded.Broadcast(Inventory);
+    BroadcastInventoryChanged();
 }
 
 //---------------------------------------------------------------------
@@ -229,7 +232,7 @@ void UACFEquipmentComponent::RemoveItem_Implementation(const FInventoryItem& ite
         // Broadcast that items have been removed.
         OnItemRemoved.Broadcast(FBaseItem(item.ItemClass, finalCount));
         // Broadcast the updated inventory.
-        OnInventoryChanged.Broadcast(Inventory);
+        BroadcastInventoryChanged();
     }
 }
 
@@ -271,6 +274,40 @@ void UACFEquipmentComponent::ToggleEquipItemByIndex_Implementation(int32 index)
     }
 }
 
+//---------------------------------------------------------------------
+// Inventory batches (added by Nomad Dev team)
+//---------------------------------------------------------------------
+void UACFEquipmentComponent::BeginInventoryBatch()
+{
+    InventoryBatchDepth++;
+}
+
+void UACFEquipmentComponent::EndInventoryBatch()
+{
+    if (InventoryBatchDepth <= 0)
+    {
+        return;
+    }
+
+    InventoryBatchDepth--;
+    if (InventoryBatchDepth == 0 && bInventoryChangedInBatch)
+    {
+        bInventoryChangedInBatch = false;
+        OnInventoryChanged.Broadcast(Inventory);
+    }
+}
+
+void UACFEquipmentComponent::BroadcastInventoryChanged()
+{
+    // Inside a batch the change is broadcast once, when the outermost batch ends
+    if (InventoryBatchDepth > 0)
+    {
+        bInventoryChangedInBatch = true;
+        return;
+    }
+    OnInventoryChanged.Broadcast(Inventory);
+}
+
 //---------------------------------------------------------------------
 // HasEnoughItemsOfType
 //---------------------------------------------------------------------
@@ -835,7 +872,7 @@ int32 UACFEquipmentComponent::Internal_AddItem(const FBaseItem& itemToAdd, bool
         // Increase the current inventory weight by the weight of the items added.
         currentInventoryWeight += itemData.ItemWeight * addeditemstotal;
         // Broadcast that the inventory has changed.
-        OnInventoryChanged.Broadcast(Inventory);
+        BroadcastInventoryChanged();
         if (addeditemstotal > 0)
         {
             // Broadcast that an item was added.
@@ -964,7 +1001,7 @@ void UACFEquipmentComponent::SwapInventoryItems_Implementation(int32 indexA, int
     Inventory[indexB].InventoryIndex = indexB;
 
     // Notify UI and listeners
-    OnInventoryChanged.Broadcast(Inventory);
+    BroadcastInventoryChanged();
 }
 
 //---------------------------------------------------------------------
@@ -1794,6 +1831,8 @@ void UACFEquipmentComponent::InitializeInventoryAndEquipment(USkeletalMeshCompon
                 UE_LOG(LogTemp, Log, TEXT("Invalid Inventory setup, too many slots on character!!! - ACFEquipmentComp"));
             }
         }
+        // The previous content was emptied without remove events
+        OnInventoryReloaded.Broadcast(Inventory);
     }
 }
 
@@ -2122,7 +2161,7 @@ void UACFEquipmentComponent::AssignItemToQuickbar_Implementation(const FGuid& It
         UpdateEquippedItemsVisibility();
 
         // if you want Blueprint-side listeners to fire:
-        OnInventoryChanged.Broadcast(Inventory);
+        BroadcastInventoryChanged();
     }
 }
 
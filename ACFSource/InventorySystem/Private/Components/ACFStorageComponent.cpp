@@ -83,16 +83,25 @@ void UACFStorageComponent::RemoveItem_Implementation(const FBaseItem& inItem)
     }
 }
 
-// Add multiple items on server by calling AddItem for each
+// Add multiple items on server, broadcasting a single change
 void UACFStorageComponent::AddItems_Implementation(const TArray<FBaseItem>& inItems)
 {
     for (const auto& item : inItems) {
-        AddItem(item);
+        Internal_AddItem(item);
     }
+
+    OnItemChanged.Broadcast(Items);
 }
 
 // Add a single item stack: stack with existing if found, else add new
 void UACFStorageComponent::AddItem_Implementation(const FBaseItem& inItem)
+{
+    Internal_AddItem(inItem);
+
+    OnItemChanged.Broadcast(Items);
+}
+
+void UACFStorageComponent::Internal_AddItem(const FBaseItem& inItem)
 {
     FBaseItem* currentItem = Items.FindByKey(inItem);
 
@@ -101,8 +110,6 @@ void UACFStorageComponent::AddItem_Implementation(const FBaseItem& inItem)
     } else {
         Items.Add(inItem);
     }
-
-    OnItemChanged.Broadcast(Items);
 }
 
 // Move items from storage to equipment component inventory
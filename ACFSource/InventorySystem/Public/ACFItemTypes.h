@@ -115,6 +115,10 @@ public:
 
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ACF)
     TSoftClassPtr<class AACFItem> ItemClass;
+
+    /*Relative chance of this slot being picked among the slots matching a generation rule*/
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = 0.f), Category = ACF)
+    float Weight = 1.f;
 };
 
 USTRUCT(BlueprintType)
@@ -589,6 +589,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "ACF | Checks")
     bool HasEnoughItemsOfType(const TArray<FBaseItem>& ItemsToCheck);
 
+    /* Added by Nomad Dev team
+     * SERVER: defers OnInventoryChanged until the matching EndInventoryBatch, so that a batch of
+     * inventory operations broadcasts a single change. Batches can be nested.
+     */
+    void BeginInventoryBatch();
+    void EndInventoryBatch();
+
     /*------------------------ DELEGATES ------------------------*/
 
     // Delegate broadcast when equipment changes.
@@ -599,6 +606,12 @@ public:
     UPROPERTY(BlueprintAssignable, Category = ACF)
     FOnInventoryChanged OnInventoryChanged;
 
+    /* Added by Nomad Dev team
+     * Delegate broadcast when the whole inventory was replaced without add/remove events (load, starting items).
+     */
+    UPROPERTY(BlueprintAssignable, Category = ACF)
+    FOnInventoryChanged OnInventoryReloaded;
+
     // Delegate broadcast when an item is added.
     UPROPERTY(BlueprintAssignable, Category = ACF)
     FOnItemAdded OnItemAdded;
@@ -728,6 +741,12 @@ protected:
      */
     void HandleInventoryChanges(const TArray<FInventoryItem>& OldInventory, const TArray<FInventoryItem>& NewInventory);
 
+    // Broadcasts OnInventoryChanged, or defers it to the end of the running inventory batch.
+    void BroadcastInventoryChanged();
+
+    int32 InventoryBatchDepth = 0;
+    bool bInventoryChangedInBatch = false;
+
 private:
     // Inventory array holding all inventory items.
     UPROPERTY(SaveGame, Replicated, ReplicatedUsing = OnRep_Inventory)
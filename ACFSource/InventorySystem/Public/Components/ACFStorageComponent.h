@@ -127,4 +127,7 @@ private:
 
     // Checks if storage is empty, broadcasts events as needed.
     void CheckEmpty();
+
+    // Stacks the item with the stored ones without broadcasting OnItemChanged.
+    void Internal_AddItem(const FBaseItem& inItem);
 };
\ No newline at end of file
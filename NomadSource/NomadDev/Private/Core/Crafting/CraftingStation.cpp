@@ -33,6 +33,7 @@ ACraftingStation::ACraftingStation()
     // Create map marker component and attach to root
     CraftingStationMapMarkerComponent = CreateDefaultSubobject<UAMSMapMarkerComponent>(TEXT("CraftingStationMapMarkerComponent"));
     CraftingStationMapMarkerComponent->SetupAttachment(GetRootComponent());
+    CraftingStationMapMarkerComponent->SetMarkerUpdateMode(EAMSMarkerUpdateMode::EStatic);
 
     // Create crafting component (child class)
     NomadCraftingComponent = CreateDefaultSubobject<UNomadCraftingComponent>(TEXT("NomadCraftingComponent"));
@@ -163,3 +164,15 @@ bool ACraftingStation::CanBeInteracted_Implementation(class APawn* Pawn)
 {
     return true; // Adjust as needed
 }
+
+
+// Components whose SaveGame properties are stored with this station
+TArray<UActorComponent*> ACraftingStation::GetComponentsToSave_Implementation() const
+{
+    TArray<UActorComponent*> ComponentsToSave;
+    if (IsValid(NomadCraftingComponent))
+    {
+        ComponentsToSave.Add(NomadCraftingComponent);
+    }
+    return ComponentsToSave;
+}
@@ -4,6 +4,8 @@
 #include "Core/Crafting/NomadCraftingComponent.h"
 
 #include "ACFCraftRecipeDataAsset.h"
+#include "Core/Crafting/NomadCraftingQueueSubsystem.h"
+#include "Net/UnrealNetwork.h"
 
 void UNomadCraftingComponent::InitializeFromDataAsset(UCraftingStationData* CraftingStationData)
 {
@@ -16,6 +18,7 @@ void UNomadCraftingComponent::InitializeFromDataAsset(UCraftingStationData* Craf
     // Clear any existing recipes before adding new ones
     CraftableItems.Empty();
     ItemsRecipes.Empty();
+    MarkRecipesChanged();
 
     // Iterate over recipe assets from CraftingStationData
     for (UDataAsset* RecipeAsset : CraftingStationData->GetItemRecipes())
@@ -35,4 +38,189 @@ void UNomadCraftingComponent::InitializeFromDataAsset(UCraftingStationData* Craf
     }
 
     UE_LOG(LogTemp, Log, TEXT("NomadCraftingComponent initialized with %d recipes"), CraftableItems.Num());
-}
\ No newline at end of file
+}
+
+void UNomadCraftingComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (GetOwner() && GetOwner()->HasAuthority())
+    {
+        ResolveCraftingQueue();
+        RegisterCraftingQueue();
+    }
+}
+
+void UNomadCraftingComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UNomadCraftingQueueSubsystem* QueueSubsystem = World->GetSubsystem<UNomadCraftingQueueSubsystem>())
+        {
+            QueueSubsystem->UnregisterQueue(this);
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UNomadCraftingComponent::OnComponentLoaded_Implementation()
+{
+    Super::OnComponentLoaded_Implementation();
+
+    // The saved timestamps already account for the time spent unloaded
+    if (GetOwner() && GetOwner()->HasAuthority())
+    {
+        ResolveCraftingQueue();
+        RegisterCraftingQueue();
+    }
+}
+
+bool UNomadCraftingComponent::EnqueueCraft(const FACFCraftingRecipe& Recipe, int32 Count, APawn* InstigatorPawn)
+{
+    if (!GetOwner() || !GetOwner()->HasAuthority())
+    {
+        return false;
+    }
+
+    if (!Recipe.OutputItem.ItemClass || Count <= 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[UNomadCraftingComponent::EnqueueCraft] Invalid recipe or count (%d)"), Count);
+        return false;
+    }
+
+    // Bring the queue up to date before checking its size
+    ResolveCraftingQueue();
+    if (CraftingQueue.Num() >= MaxQueuedJobs)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[UNomadCraftingComponent::EnqueueCraft] Queue of %s is full"), *GetNameSafe(GetOwner()));
+        return false;
+    }
+
+    // Jobs run one after the other, a new job starts when the last one ends
+    const double Now = UNomadCraftingQueueSubsystem::GetQueueTime();
+    FNomadCraftingJob NewJob;
+    NewJob.OutputItemClass = Recipe.OutputItem.ItemClass;
+    NewJob.OutputCount = FMath::Max(Recipe.OutputItem.Count, 1);
+    NewJob.RemainingCrafts = Count;
+    NewJob.CraftDuration = FMath::Max(Recipe.CraftingTime, 0.f);
+    NewJob.StartTime = CraftingQueue.Num() > 0 ? FMath::Max(Now, CraftingQueue.Last().GetEndTime()) : Now;
+    CraftingQueue.Add(NewJob);
+
+    OnCraftingQueueChanged.Broadcast();
+
+    // Instant recipes complete right away
+    ResolveCraftingQueue();
+    RegisterCraftingQueue();
+    return true;
+}
+
+void UNomadCraftingComponent::ResolveCraftingQueue()
+{
+    if (!GetOwner() || !GetOwner()->HasAuthority() || CraftingQueue.Num() == 0)
+    {
+        return;
+    }
+
+    const double Now = UNomadCraftingQueueSubsystem::GetQueueTime();
+    bool bQueueChanged = false;
+
+    while (CraftingQueue.Num() > 0)
+    {
+        FNomadCraftingJob& Job = CraftingQueue[0];
+
+        // Number of crafts completed since the job's current craft started
+        int32 CompletedCrafts = Job.RemainingCrafts;
+        if (Job.CraftDuration > 0.f)
+        {
+            const double Elapsed = Now - Job.StartTime;
+            CompletedCrafts = Elapsed > 0.0 ? FMath::Min(FMath::FloorToInt(Elapsed / Job.CraftDuration), Job.RemainingCrafts) : 0;
+        }
+
+        if (CompletedCrafts <= 0)
+        {
+            break;
+        }
+
+        AddItemToStorageByClass(Job.OutputItemClass, CompletedCrafts * Job.OutputCount);
+        Job.StartTime += static_cast<double>(Job.CraftDuration) * CompletedCrafts;
+        Job.RemainingCrafts -= CompletedCrafts;
+        bQueueChanged = true;
+
+        if (Job.RemainingCrafts > 0)
+        {
+            break;
+        }
+
+        // The next job starts from where this one ended, not from the resolve time
+        const double JobEndTime = Job.StartTime;
+        CraftingQueue.RemoveAt(0);
+        if (CraftingQueue.Num() > 0)
+        {
+            CraftingQueue[0].StartTime = FMath::Max(CraftingQueue[0].StartTime, JobEndTime);
+        }
+    }
+
+    if (bQueueChanged)
+    {
+        OnCraftingQueueChanged.Broadcast();
+        if (CraftingQueue.Num() == 0)
+        {
+            OnCraftComplete.Broadcast();
+        }
+    }
+}
+
+float UNomadCraftingComponent::GetQueuedJobProgress(int32 JobIndex) const
+{
+    if (!CraftingQueue.IsValidIndex(JobIndex))
+    {
+        return 0.f;
+    }
+
+    const FNomadCraftingJob& Job = CraftingQueue[JobIndex];
+    if (Job.CraftDuration <= 0.f)
+    {
+        return 1.f;
+    }
+
+    const double Elapsed = UNomadCraftingQueueSubsystem::GetQueueTime() - Job.StartTime;
+    return FMath::Clamp(static_cast<float>(Elapsed / Job.CraftDuration), 0.f, 1.f);
+}
+
+double UNomadCraftingComponent::GetNextCompletionTime() const
+{
+    if (CraftingQueue.Num() == 0)
+    {
+        return TNumericLimits<double>::Max();
+    }
+    return CraftingQueue[0].StartTime + CraftingQueue[0].CraftDuration;
+}
+
+void UNomadCraftingComponent::OnRep_CraftingQueue()
+{
+    OnCraftingQueueChanged.Broadcast();
+}
+
+void UNomadCraftingComponent::RegisterCraftingQueue()
+{
+    if (!HasQueuedCrafts())
+    {
+        return;
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UNomadCraftingQueueSubsystem* QueueSubsystem = World->GetSubsystem<UNomadCraftingQueueSubsystem>())
+        {
+            QueueSubsystem->RegisterQueue(this);
+        }
+    }
+}
+
+void UNomadCraftingComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(UNomadCraftingComponent, CraftingQueue);
+}
@@ -0,0 +1,90 @@
+// Copyright (C) Developed by Gamegine, Published by Gamegine 2025. All Rights Reserved.
+
+
+#include "Core/Crafting/NomadCraftingQueueSubsystem.h"
+
+#include "Core/Crafting/NomadCraftingComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+double UNomadCraftingQueueSubsystem::GetQueueTime()
+{
+    return (FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalSeconds();
+}
+
+void UNomadCraftingQueueSubsystem::RegisterQueue(UNomadCraftingComponent* CraftingComponent)
+{
+    if (!IsValid(CraftingComponent))
+    {
+        return;
+    }
+
+    ActiveQueues.AddUnique(CraftingComponent);
+    ScheduleNextResolve();
+}
+
+void UNomadCraftingQueueSubsystem::UnregisterQueue(UNomadCraftingComponent* CraftingComponent)
+{
+    if (ActiveQueues.Remove(CraftingComponent) > 0)
+    {
+        ScheduleNextResolve();
+    }
+}
+
+void UNomadCraftingQueueSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(ResolveTimerHandle);
+    }
+    ActiveQueues.Empty();
+
+    Super::Deinitialize();
+}
+
+void UNomadCraftingQueueSubsystem::ScheduleNextResolve()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    // Find the earliest completion among the loaded stations, dropping the ones with nothing left to craft
+    double NextCompletion = TNumericLimits<double>::Max();
+    for (int32 Index = ActiveQueues.Num() - 1; Index >= 0; --Index)
+    {
+        const UNomadCraftingComponent* CraftingComponent = ActiveQueues[Index].Get();
+        if (!CraftingComponent || !CraftingComponent->HasQueuedCrafts())
+        {
+            ActiveQueues.RemoveAtSwap(Index);
+            continue;
+        }
+        NextCompletion = FMath::Min(NextCompletion, CraftingComponent->GetNextCompletionTime());
+    }
+
+    if (ActiveQueues.Num() == 0)
+    {
+        World->GetTimerManager().ClearTimer(ResolveTimerHandle);
+        return;
+    }
+
+    // Timers need a positive delay, completions already due are resolved on the next tick
+    const float Delay = FMath::Max(static_cast<float>(NextCompletion - GetQueueTime()), KINDA_SMALL_NUMBER);
+    World->GetTimerManager().SetTimer(ResolveTimerHandle, this, &UNomadCraftingQueueSubsystem::HandleResolveTimer, Delay, false);
+}
+
+void UNomadCraftingQueueSubsystem::HandleResolveTimer()
+{
+    // Resolving can unregister stations, iterate over a copy
+    const TArray<TWeakObjectPtr<UNomadCraftingComponent>> Queues = ActiveQueues;
+    for (const TWeakObjectPtr<UNomadCraftingComponent>& Queue : Queues)
+    {
+        if (UNomadCraftingComponent* CraftingComponent = Queue.Get())
+        {
+            CraftingComponent->ResolveCraftingQueue();
+        }
+    }
+
+    ScheduleNextResolve();
+}
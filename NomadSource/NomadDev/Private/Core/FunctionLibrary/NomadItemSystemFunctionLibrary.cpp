@@ -61,6 +61,11 @@ AACFWorldItem* UNomadItemSystemFunctionLibrary::SpawnResourceWorldItemNearLocati
                 );
         }
     }
+    else
+    {
+        // Items dropped in place rest immediately, fold them into nearby stacks of the same item
+        NomadWorldItem->TryMergeWithNearbyItems();
+    }
 
     return NomadWorldItem;
 }
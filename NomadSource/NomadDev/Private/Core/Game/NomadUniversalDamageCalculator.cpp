@@ -71,7 +71,8 @@ FGameplayTag UNomadUniversalDamageCalculator::EvaluateHitResponseAction_Implemen
         return FGameplayTag();
 
     // Option B: Using tags
-    if (DamageTypeCDO && DamageTypeCDO->DamageTags.HasTag(FGameplayTag::RequestGameplayTag("Damage.NoHitResponse")))
+    static const FGameplayTag NoHitResponseTag = FGameplayTag::RequestGameplayTag("Damage.NoHitResponse");
+    if (DamageTypeCDO && DamageTypeCDO->DamageTags.HasTag(NoHitResponseTag))
         return FGameplayTag();
 
     // Otherwise, use parent/default logic
@@ -3,8 +3,11 @@
 
 #include "Core/Item/NomadWorldItem.h"
 
+#include "ACFItemSystemFunctionLibrary.h"
 #include "Components/ACFStorageComponent.h"
 #include "Core/Data/Item/Resource/PickupItemActorData.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
 #include "GameplayTagsManager.h"
 
 ANomadWorldItem::ANomadWorldItem()
@@ -130,6 +133,8 @@ void ANomadWorldItem::StopPhysics()
     NetUpdateFrequency = 10;
     MinNetUpdateFrequency = 1;
 
+    TryMergeWithNearbyItems();
+
     SetNetDormancy(DORM_DormantAll);
 
     // snap into final pose (so clients see exact resting state)
@@ -137,6 +142,61 @@ void ANomadWorldItem::StopPhysics()
     SetActorRotation(GetActorRotation());
 }
 
+void ANomadWorldItem::TryMergeWithNearbyItems()
+{
+    if (!HasAuthority() || !ObjectMesh || MergeRadius <= 0.f || IsActorBeingDestroyed())
+    {
+        return;
+    }
+
+    // Only single item stacks are merged, mixed containers keep their contents as they are
+    const TArray<FBaseItem> Items = GetItems();
+    if (Items.Num() != 1 || !Items[0].ItemClass)
+    {
+        return;
+    }
+
+    FItemDescriptor ItemData;
+    UACFItemSystemFunctionLibrary::GetItemData(Items[0].ItemClass, ItemData);
+    const int32 MaxStackSize = ItemData.MaxInventoryStack;
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(NomadWorldItemMerge), false, this);
+    TArray<FOverlapResult> Overlaps;
+    GetWorld()->OverlapMultiByObjectType(Overlaps, GetActorLocation(), FQuat::Identity,
+        FCollisionObjectQueryParams(ObjectMesh->GetCollisionObjectType()), FCollisionShape::MakeSphere(MergeRadius), Params);
+
+    int32 MergedCount = Items[0].Count;
+    for (const FOverlapResult& Overlap : Overlaps)
+    {
+        ANomadWorldItem* Other = Cast<ANomadWorldItem>(Overlap.GetActor());
+        if (!Other || Other == this || Other->IsActorBeingDestroyed() || Other->PickupItemData != PickupItemData)
+        {
+            continue;
+        }
+
+        // Items still tumbling will try to merge on their own once they come to rest
+        if (Other->ObjectMesh && Other->ObjectMesh->IsSimulatingPhysics())
+        {
+            continue;
+        }
+
+        const TArray<FBaseItem> OtherItems = Other->GetItems();
+        if (OtherItems.Num() != 1 || OtherItems[0].ItemClass != Items[0].ItemClass)
+        {
+            continue;
+        }
+
+        if (MaxStackSize > 0 && MergedCount + OtherItems[0].Count > MaxStackSize)
+        {
+            continue;
+        }
+
+        AddItem(OtherItems[0]);
+        MergedCount += OtherItems[0].Count;
+        Other->Destroy();
+    }
+}
+
 FText ANomadWorldItem::GetInteractableName_Implementation()
 {
     return PickupItemData->GetPickupActorInfo().GetItemName();
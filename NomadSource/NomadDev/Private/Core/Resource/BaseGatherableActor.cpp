@@ -1,12 +1,15 @@
 // Core/Resource/BaseGatherableActor.cpp
 #include "Core/Resource/BaseGatherableActor.h"
 
+#include "ACFItemSystemFunctionLibrary.h"
 #include "Components/ACFEquipmentComponent.h"
 #include "Components/ACFStorageComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Core/Data/Item/Resource/GatherableActorData.h"
 #include "Core/FunctionLibrary/NomadItemSystemFunctionLibrary.h"
+#include "Core/Resource/NomadResourceNodeManager.h"
 #include "Game/ACFFunctionLibrary.h"
+#include "GameFramework/PlayerController.h"
 #include "Net/UnrealNetwork.h"
 
 
@@ -94,11 +97,11 @@ void ABaseGatherableActor::BeginPlay()
         ActorMesh->SetStaticMesh(Info.GetGatherableMesh());
     }
 
-    // Initialize the health of the gatherable actor
-    CurrentHealth = Info.GetMaxHealth();
+    // Initialize the health of the gatherable actor, promoted nodes resume from their stored health
+    CurrentHealth = ResourceNodeManager.IsValid() ? ResourceNodeManager->GetNodeHealth(ResourceNodeIndex) : Info.GetMaxHealth();
 }
 
-void ABaseGatherableActor::StartGather()
+void ABaseGatherableActor::StartGather(APawn* InGatherer)
 {
     if (bGatherableActorDepleted) return;
     
@@ -110,6 +113,12 @@ void ABaseGatherableActor::StartGather()
     }
     if (!GatherableItemData) return;
 
+    // Keep the gatherer set by a previous interaction if none is provided
+    if (InGatherer)
+    {
+        SetGatherer(InGatherer);
+    }
+
     const FGatherableActorInfo& Info = GatherableItemData->GatherableActorInfo;
     
     // Decrease health by the damage per hit (e.g., the player hits the resource)
@@ -127,6 +136,12 @@ void ABaseGatherableActor::ServerStartGather_Implementation()
     // Server-side logic for gathering, to ensure server authority
     if (!GatherableItemData) return;
 
+    // Never trust a client supplied pawn as loot recipient, use the player behind the connection
+    if (APawn* ConnectionPawn = GetOwningConnectionPawn())
+    {
+        SetGatherer(ConnectionPawn);
+    }
+
     const FGatherableActorInfo& Info = GatherableItemData->GatherableActorInfo;
     
     // Decrease health on the server
@@ -150,6 +165,12 @@ void ABaseGatherableActor::ChangeMeshesWhileGathering()
     if (!GatherableItemData) return;
     const FGatherableActorInfo& Info = GatherableItemData->GatherableActorInfo;
 
+    // Keep the node this actor was promoted from alive and up to date
+    if (ResourceNodeManager.IsValid())
+    {
+        ResourceNodeManager->NotifyNodeHit(ResourceNodeIndex, CurrentHealth);
+    }
+
     // Calculate health percentage based on the current health
     const int32 HealthPercentage = (CurrentHealth * 100) / Info.GetMaxHealth();
     
@@ -204,6 +225,12 @@ void ABaseGatherableActor::OnInteractedByPawn_Implementation(class APawn* Pawn,
     // If no data or the actor is already depleted, exit
     if (!GatherableItemData) return;
     const FGatherableActorInfo& Info = GatherableItemData->GatherableActorInfo;
+
+    // The interacting pawn receives the loot of the gather actions that follow
+    if (Pawn)
+    {
+        SetGatherer(Pawn);
+    }
     
     if (Pawn && !bGatherableActorDepleted && Info.IsPickupItem())
     {
@@ -223,6 +250,12 @@ void ABaseGatherableActor::OnInteractedByPawn_Implementation(class APawn* Pawn,
             // Gather currency (if applicable) for the interaction
             StorageComponent->GatherCurrency(StorageComponent->GetCurrentCurrencyAmount(), StorageComponent->GetPawnCurrencyComponent(Pawn));
             bGatherableActorDepleted = true; // Mark the actor as depleted after gathering
+
+            // The manager keeps the node hidden until it respawns
+            if (ResourceNodeManager.IsValid())
+            {
+                ResourceNodeManager->NotifyNodeDepleted(ResourceNodeIndex);
+            }
         }
 
         // Start the timer to reset the depletion state after a delay (e.g., 5 seconds)
@@ -274,6 +307,13 @@ void ABaseGatherableActor::OnGatherComplete()
     
     // Mark the health as 0 after gathering is complete
     CurrentHealth = 0;
+
+    // The manager keeps the node hidden until it respawns
+    if (ResourceNodeManager.IsValid())
+    {
+        ResourceNodeManager->NotifyNodeDepleted(ResourceNodeIndex);
+    }
+
     HandlePostGather(); // Finalize the mesh update
 }
 
@@ -288,6 +328,12 @@ void ABaseGatherableActor::HandlePostGather()
         OnRep_GatherableActorDepleted();  // Replicate the change to clients
     }
 
+    // The gather is over once depleted, the next one sets its own gatherer
+    if (bGatherableActorDepleted)
+    {
+        SetGatherer(nullptr);
+    }
+
     // If the actor is depleted and should be destroyed, destroy it
     if (bGatherableActorDepleted && Info.ShouldDestroyAfterGather())
     {
@@ -303,27 +349,68 @@ void ABaseGatherableActor::SpawnGatheredLoot()
     // Spawn loot items for the player
     for (const FGatheredItem& Entry : Info.GetLootItems())
     {
-        if (Entry.ResourceItem.ItemClass && Entry.ResourceItem.Count > 0)
+        if (!Entry.ResourceItem.ItemClass || Entry.ResourceItem.Count <= 0)
+        {
+            continue;
+        }
+
+        int32 RemainingCount = Entry.ResourceItem.Count;
+
+        // Give as much as the gatherer can carry, the rest is dropped
+        if (Info.GetLootSpawnMode() == EGatheredLootSpawnMode::EDirectToInventory && Gatherer.IsValid())
         {
-            for (int32 i = 0; i < Entry.ResourceItem.Count; ++i)
+            if (UACFEquipmentComponent* EquipComp = Gatherer->FindComponentByClass<UACFEquipmentComponent>())
             {
-                FVector Offset(
-                    FMath::FRandRange(-200.f,200.f),  // Random offset for item placement
-                    FMath::FRandRange(-200.f,200.f),
-                    10.f
-                );
-
-                // Spawn the loot items at a random offset from the actor's location
-                UNomadItemSystemFunctionLibrary::SpawnResourceWorldItemNearLocation(
-                    this,
-                    { FBaseItem(Entry.ResourceItem.ItemClass, 1) },  // Spawn one item at a time
-                    GetActorLocation() + Offset,  // Position the loot
-                    100.f,  // Drop radius
-                    Info.UsesPhysicsDrop(), // Whether the loot should use physics
-                    Entry.GetPickupItemActorData()
-                );
+                const int32 CountToGive = FMath::Min(RemainingCount, EquipComp->NumberOfItemCanTake(Entry.ResourceItem.ItemClass));
+                if (CountToGive > 0)
+                {
+                    EquipComp->AddItemToInventory(FBaseItem(Entry.ResourceItem.ItemClass, CountToGive));
+                    RemainingCount -= CountToGive;
+                }
             }
         }
+
+        if (RemainingCount <= 0)
+        {
+            continue;
+        }
+
+        // Stacked drops hold up to the item's max inventory stack, per unit drops hold one unit each
+        int32 MaxStackSize = 1;
+        if (Info.GetLootSpawnMode() != EGatheredLootSpawnMode::EPerUnit)
+        {
+            FItemDescriptor ItemData;
+            UACFItemSystemFunctionLibrary::GetItemData(Entry.ResourceItem.ItemClass, ItemData);
+            MaxStackSize = ItemData.MaxInventoryStack > 0 ? ItemData.MaxInventoryStack : RemainingCount;
+        }
+        SpawnLootWorldItems(Entry, RemainingCount, MaxStackSize);
+    }
+}
+
+void ABaseGatherableActor::SpawnLootWorldItems(const FGatheredItem& Entry, int32 Count, int32 MaxStackSize)
+{
+    const FGatherableActorInfo& Info = GatherableItemData->GatherableActorInfo;
+
+    while (Count > 0)
+    {
+        const int32 StackCount = FMath::Min(Count, MaxStackSize);
+        Count -= StackCount;
+
+        FVector Offset(
+            FMath::FRandRange(-200.f,200.f),  // Random offset for item placement
+            FMath::FRandRange(-200.f,200.f),
+            10.f
+        );
+
+        // Spawn the loot stack at a random offset from the actor's location
+        UNomadItemSystemFunctionLibrary::SpawnResourceWorldItemNearLocation(
+            this,
+            { FBaseItem(Entry.ResourceItem.ItemClass, StackCount) },
+            GetActorLocation() + Offset,  // Position the loot
+            100.f,  // Drop radius
+            Info.UsesPhysicsDrop(), // Whether the loot should use physics
+            Entry.GetPickupItemActorData()
+        );
     }
 }
 
@@ -378,4 +465,28 @@ void ABaseGatherableActor::GetCharacterControlRotation_Implementation(FRotator C
     ControlRotationForwardVector = ForwardVector;
 }
 
+void ABaseGatherableActor::SetGatherer(APawn* InGatherer)
+{
+    Gatherer = InGatherer;
+}
+
+APawn* ABaseGatherableActor::GetOwningConnectionPawn() const
+{
+    AActor* OwnerActor = GetOwner();
+    if (const APlayerController* PlayerController = Cast<APlayerController>(OwnerActor))
+    {
+        return PlayerController->GetPawn();
+    }
+    if (APawn* OwnerPawn = Cast<APawn>(OwnerActor))
+    {
+        return OwnerPawn;
+    }
+    return nullptr;
+}
 
+void ABaseGatherableActor::InitializeFromResourceNode(ANomadResourceNodeManager* InManager, int32 InNodeIndex, UGatherableActorData* InGatherableItemData)
+{
+    ResourceNodeManager = InManager;
+    ResourceNodeIndex = InNodeIndex;
+    GatherableItemData = InGatherableItemData;
+}
\ No newline at end of file
@@ -0,0 +1,431 @@
+// Copyright (C) Developed by Gamegine, Published by Gamegine 2025. All Rights Reserved.
+
+
+#include "Core/Resource/NomadResourceNodeManager.h"
+
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Core/Data/Item/Resource/GatherableActorData.h"
+#include "Core/Resource/BaseGatherableActor.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
+
+void FNomadResourceNodeDeltaArray::SetNodeStage(int32 NodeIndex, ENomadResourceNodeStage Stage)
+{
+    const int32 ItemIndex = Items.IndexOfByPredicate([NodeIndex](const FNomadResourceNodeDelta& Item)
+    {
+        return Item.NodeIndex == NodeIndex;
+    });
+
+    if (Stage == ENomadResourceNodeStage::EUntouched)
+    {
+        if (ItemIndex != INDEX_NONE)
+        {
+            Items.RemoveAtSwap(ItemIndex);
+            MarkArrayDirty();
+        }
+        return;
+    }
+
+    FNomadResourceNodeDelta& Item = ItemIndex != INDEX_NONE ? Items[ItemIndex] : Items.AddDefaulted_GetRef();
+    Item.NodeIndex = NodeIndex;
+    Item.Stage = Stage;
+    MarkItemDirty(Item);
+}
+
+void FNomadResourceNodeDeltaArray::PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize)
+{
+    if (!Owner)
+    {
+        return;
+    }
+
+    for (const int32 Index : RemovedIndices)
+    {
+        Owner->ApplyNodeStage(Items[Index].NodeIndex, ENomadResourceNodeStage::EUntouched);
+    }
+}
+
+void FNomadResourceNodeDeltaArray::PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize)
+{
+    if (!Owner)
+    {
+        return;
+    }
+
+    for (const int32 Index : AddedIndices)
+    {
+        Owner->ApplyNodeStage(Items[Index].NodeIndex, Items[Index].Stage);
+    }
+}
+
+void FNomadResourceNodeDeltaArray::PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 FinalSize)
+{
+    PostReplicatedAdd(ChangedIndices, FinalSize);
+}
+
+ANomadResourceNodeManager::ANomadResourceNodeManager()
+{
+    // Nodes are driven by a single timer, nothing to do per frame
+    PrimaryActorTick.bCanEverTick = false;
+
+    // One always relevant actor replaces the relevancy checks of every node, it only sends node deltas
+    bReplicates = true;
+    bAlwaysRelevant = true;
+    NetUpdateFrequency = 2.f;
+    MinNetUpdateFrequency = 1.f;
+
+    NodeInstances = CreateDefaultSubobject<UHierarchicalInstancedStaticMeshComponent>(TEXT("NodeInstances"));
+    RootComponent = NodeInstances;
+    NodeInstances->SetCollisionProfileName(TEXT("BlockAll"));
+    NodeInstances->bReceivesDecals = false;
+
+    NodeDeltas.SetOwner(this);
+}
+
+void ANomadResourceNodeManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(ANomadResourceNodeManager, NodeDeltas);
+}
+
+void ANomadResourceNodeManager::BeginPlay()
+{
+    Super::BeginPlay();
+
+    NodeDeltas.SetOwner(this);
+
+    // Keep the authored transforms, hidden instances are collapsed and restored from them
+    const int32 NodeCount = NodeInstances->GetInstanceCount();
+    OriginalTransforms.SetNum(NodeCount);
+    for (int32 Index = 0; Index < NodeCount; ++Index)
+    {
+        NodeInstances->GetInstanceTransform(Index, OriginalTransforms[Index], /*bWorldSpace=*/ false);
+    }
+
+    if (!HasAuthority())
+    {
+        // Deltas may have been received before BeginPlay
+        for (const FNomadResourceNodeDelta& Item : NodeDeltas.Items)
+        {
+            ApplyNodeStage(Item.NodeIndex, Item.Stage);
+        }
+        return;
+    }
+
+    if (!GatherableItemData || !GatherableActorClass)
+    {
+        UE_LOG(LogTemp, Error, TEXT("%s: No GatherableItemData or GatherableActorClass assigned!"), *GetName());
+        return;
+    }
+
+    FNomadResourceNode DefaultNode;
+    DefaultNode.Health = GatherableItemData->GatherableActorInfo.GetMaxHealth();
+    Nodes.Init(DefaultNode, NodeCount);
+}
+
+void ANomadResourceNodeManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    GetWorldTimerManager().ClearTimer(SchedulerTimerHandle);
+
+    for (const TPair<int32, TWeakObjectPtr<ABaseGatherableActor>>& Promoted : PromotedActors)
+    {
+        if (ABaseGatherableActor* PromotedActor = Promoted.Value.Get())
+        {
+            PromotedActor->Destroy();
+        }
+    }
+    PromotedActors.Empty();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+ABaseGatherableActor* ANomadResourceNodeManager::PromoteNode(int32 NodeIndex)
+{
+    if (!HasAuthority() || !Nodes.IsValidIndex(NodeIndex))
+    {
+        return nullptr;
+    }
+
+    FNomadResourceNode& Node = Nodes[NodeIndex];
+    if (Node.Stage == ENomadResourceNodeStage::EDepleted)
+    {
+        return nullptr;
+    }
+
+    if (Node.Stage == ENomadResourceNodeStage::EPromoted)
+    {
+        if (ABaseGatherableActor* PromotedActor = PromotedActors.FindRef(NodeIndex).Get())
+        {
+            return PromotedActor;
+        }
+
+        // The actor went away on its own (picked up, destroyed after gather), the node is used up until it respawns
+        PromotedActors.Remove(NodeIndex);
+        NotifyNodeDepleted(NodeIndex);
+        return nullptr;
+    }
+
+    const FTransform SpawnTransform = OriginalTransforms[NodeIndex] * NodeInstances->GetComponentTransform();
+    ABaseGatherableActor* PromotedActor = GetWorld()->SpawnActorDeferred<ABaseGatherableActor>(
+        GatherableActorClass,
+        SpawnTransform,
+        /*Owner=*/ this,
+        /*Instigator=*/ nullptr,
+        ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+        );
+
+    if (!PromotedActor)
+    {
+        UE_LOG(LogTemp, Error, TEXT("%s: Failed to promote resource node %d!"), *GetName(), NodeIndex);
+        return nullptr;
+    }
+
+    PromotedActor->InitializeFromResourceNode(this, NodeIndex, GatherableItemData);
+    PromotedActor->FinishSpawning(SpawnTransform);
+
+    PromotedActors.Add(NodeIndex, PromotedActor);
+    SetNodeStage(NodeIndex, ENomadResourceNodeStage::EPromoted, PromotedIdleTime);
+    return PromotedActor;
+}
+
+ABaseGatherableActor* ANomadResourceNodeManager::PromoteNodeFromHit(const FHitResult& Hit)
+{
+    if (Hit.GetComponent() != NodeInstances)
+    {
+        return nullptr;
+    }
+
+    // For instanced meshes, the hit item is the instance index
+    return PromoteNode(Hit.Item);
+}
+
+void ANomadResourceNodeManager::OnInteractedByPawn_Implementation(APawn* Pawn, const FString& interactionType)
+{
+    if (!HasAuthority() || !Pawn)
+    {
+        return;
+    }
+
+    // The promoted actor is interactable on its own, later interactions usually reach it directly
+    if (ABaseGatherableActor* PromotedActor = PromoteInteractedNode(Pawn))
+    {
+        IACFInteractableInterface::Execute_OnInteractedByPawn(PromotedActor, Pawn, interactionType);
+    }
+}
+
+ABaseGatherableActor* ANomadResourceNodeManager::PromoteInteractedNode(const APawn* Pawn)
+{
+    // The interaction detector only reports this actor, find the instance from the pawn's view
+    const FVector TraceStart = Pawn->GetPawnViewLocation();
+    const FVector TraceEnd = TraceStart + Pawn->GetBaseAimRotation().Vector() * InteractionDistance;
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(NomadResourceNodeInteraction), /*bTraceComplex=*/ false, Pawn);
+
+    FHitResult Hit;
+    if (GetWorld()->LineTraceSingleByChannel(Hit, TraceStart, TraceEnd, ECC_Visibility, QueryParams))
+    {
+        if (ABaseGatherableActor* PromotedActor = PromoteNodeFromHit(Hit))
+        {
+            return PromotedActor;
+        }
+    }
+
+    // Not looking at a node, fall back to the nearest one in reach
+    return PromoteNode(FindNearestNode(Pawn->GetActorLocation(), InteractionDistance));
+}
+
+FVector ANomadResourceNodeManager::GetInteractionLocation_Implementation(const FVector& viewLocation) const
+{
+    // Scoring runs on the interacting client, which only knows the replicated stages
+    const int32 NearestNode = FindNearestNode(viewLocation, InteractionDistance);
+    if (!OriginalTransforms.IsValidIndex(NearestNode))
+    {
+        return GetActorLocation();
+    }
+    return NodeInstances->GetComponentTransform().TransformPosition(OriginalTransforms[NearestNode].GetLocation());
+}
+
+int32 ANomadResourceNodeManager::FindNearestNode(const FVector& Location, float Radius) const
+{
+    int32 NearestNode = INDEX_NONE;
+    float NearestDistSquared = FMath::Square(Radius);
+    for (const int32 NodeIndex : NodeInstances->GetInstancesOverlappingSphere(Location, Radius))
+    {
+        if (!OriginalTransforms.IsValidIndex(NodeIndex) || GetNodeStage(NodeIndex) == ENomadResourceNodeStage::EDepleted)
+        {
+            continue;
+        }
+
+        const FVector NodeLocation = NodeInstances->GetComponentTransform().TransformPosition(OriginalTransforms[NodeIndex].GetLocation());
+        const float DistSquared = FVector::DistSquared(Location, NodeLocation);
+        if (DistSquared <= NearestDistSquared)
+        {
+            NearestDistSquared = DistSquared;
+            NearestNode = NodeIndex;
+        }
+    }
+    return NearestNode;
+}
+
+ENomadResourceNodeStage ANomadResourceNodeManager::GetNodeStage(int32 NodeIndex) const
+{
+    if (Nodes.IsValidIndex(NodeIndex))
+    {
+        return Nodes[NodeIndex].Stage;
+    }
+
+    // Clients only know the replicated deltas
+    for (const FNomadResourceNodeDelta& Item : NodeDeltas.Items)
+    {
+        if (Item.NodeIndex == NodeIndex)
+        {
+            return Item.Stage;
+        }
+    }
+    return ENomadResourceNodeStage::EUntouched;
+}
+
+int32 ANomadResourceNodeManager::GetNodeHealth(int32 NodeIndex) const
+{
+    return Nodes.IsValidIndex(NodeIndex) ? Nodes[NodeIndex].Health : 0;
+}
+
+void ANomadResourceNodeManager::NotifyNodeHit(int32 NodeIndex, int32 Health)
+{
+    if (!Nodes.IsValidIndex(NodeIndex) || Nodes[NodeIndex].Stage != ENomadResourceNodeStage::EPromoted)
+    {
+        return;
+    }
+
+    Nodes[NodeIndex].Health = Health;
+
+    // Push back the demotion, no replication needed since the stage didn't change
+    Nodes[NodeIndex].StageEndTime = GetWorld()->GetTimeSeconds() + PromotedIdleTime;
+}
+
+void ANomadResourceNodeManager::NotifyNodeDepleted(int32 NodeIndex)
+{
+    if (!Nodes.IsValidIndex(NodeIndex) || Nodes[NodeIndex].Stage == ENomadResourceNodeStage::EDepleted)
+    {
+        return;
+    }
+
+    // The promoted actor finishes its own gather flow (loot, next stage, destruction) and is cleaned up on demotion
+    Nodes[NodeIndex].Health = 0;
+    SetNodeStage(NodeIndex, ENomadResourceNodeStage::EDepleted, RespawnDelay);
+}
+
+void ANomadResourceNodeManager::ApplyNodeStage(int32 NodeIndex, ENomadResourceNodeStage Stage)
+{
+    if (!OriginalTransforms.IsValidIndex(NodeIndex))
+    {
+        return;
+    }
+
+    // Promoted nodes are drawn by their actor and depleted ones are gone, both collapse the instance
+    FTransform InstanceTransform = OriginalTransforms[NodeIndex];
+    if (Stage != ENomadResourceNodeStage::EUntouched)
+    {
+        InstanceTransform.SetScale3D(FVector::ZeroVector);
+    }
+
+    NodeInstances->UpdateInstanceTransform(NodeIndex, InstanceTransform, /*bWorldSpace=*/ false, /*bMarkRenderStateDirty=*/ true, /*bTeleport=*/ true);
+}
+
+void ANomadResourceNodeManager::SetNodeStage(int32 NodeIndex, ENomadResourceNodeStage Stage, float StageDuration)
+{
+    FNomadResourceNode& Node = Nodes[NodeIndex];
+    Node.Stage = Stage;
+    Node.StageEndTime = GetWorld()->GetTimeSeconds() + StageDuration;
+
+    if (Stage == ENomadResourceNodeStage::EUntouched)
+    {
+        ActiveNodes.Remove(NodeIndex);
+    }
+    else
+    {
+        ActiveNodes.Add(NodeIndex);
+    }
+
+    NodeDeltas.SetNodeStage(NodeIndex, Stage);
+    ApplyNodeStage(NodeIndex, Stage);
+    ScheduleNextUpdate();
+}
+
+void ANomadResourceNodeManager::DemoteNode(int32 NodeIndex)
+{
+    TWeakObjectPtr<ABaseGatherableActor> PromotedActor;
+    if (PromotedActors.RemoveAndCopyValue(NodeIndex, PromotedActor) && PromotedActor.IsValid())
+    {
+        PromotedActor->Destroy();
+    }
+
+    // Depleted nodes stay hidden until they respawn
+    if (Nodes[NodeIndex].Stage == ENomadResourceNodeStage::EPromoted)
+    {
+        SetNodeStage(NodeIndex, ENomadResourceNodeStage::EUntouched, 0.f);
+    }
+}
+
+void ANomadResourceNodeManager::ScheduleNextUpdate()
+{
+    if (ActiveNodes.Num() == 0)
+    {
+        GetWorldTimerManager().ClearTimer(SchedulerTimerHandle);
+        return;
+    }
+
+    float NextUpdateTime = TNumericLimits<float>::Max();
+    for (const int32 NodeIndex : ActiveNodes)
+    {
+        NextUpdateTime = FMath::Min(NextUpdateTime, Nodes[NodeIndex].StageEndTime);
+    }
+
+    // Timers need a positive delay, updates already due run on the next tick
+    const float Delay = FMath::Max(NextUpdateTime - GetWorld()->GetTimeSeconds(), KINDA_SMALL_NUMBER);
+    GetWorldTimerManager().SetTimer(SchedulerTimerHandle, this, &ANomadResourceNodeManager::HandleSchedulerTimer, Delay, false);
+}
+
+void ANomadResourceNodeManager::HandleSchedulerTimer()
+{
+    const float Now = GetWorld()->GetTimeSeconds();
+
+    // Updating a node edits ActiveNodes, collect the due ones first
+    TArray<int32> DueNodes;
+    for (const int32 NodeIndex : ActiveNodes)
+    {
+        if (Nodes[NodeIndex].StageEndTime <= Now)
+        {
+            DueNodes.Add(NodeIndex);
+        }
+    }
+
+    for (const int32 NodeIndex : DueNodes)
+    {
+        FNomadResourceNode& Node = Nodes[NodeIndex];
+        if (Node.Stage == ENomadResourceNodeStage::EPromoted)
+        {
+            if (PromotedActors.FindRef(NodeIndex).IsValid())
+            {
+                DemoteNode(NodeIndex);
+            }
+            else
+            {
+                // Same as PromoteNode, a vanished actor leaves a used up node
+                PromotedActors.Remove(NodeIndex);
+                NotifyNodeDepleted(NodeIndex);
+            }
+        }
+        else if (Node.Stage == ENomadResourceNodeStage::EDepleted)
+        {
+            // The depleted actor may still be around if it isn't destroyed after gathering
+            DemoteNode(NodeIndex);
+            Node.Health = GatherableItemData->GatherableActorInfo.GetMaxHealth();
+            SetNodeStage(NodeIndex, ENomadResourceNodeStage::EUntouched, 0.f);
+        }
+    }
+
+    ScheduleNextUpdate();
+}
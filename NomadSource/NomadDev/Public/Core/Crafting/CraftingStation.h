@@ -31,6 +31,9 @@ public:
 
     virtual bool CanBeInteracted_Implementation(class APawn* Pawn) override;
 
+    // Saves the crafting component so queued crafts survive unloading.
+    virtual TArray<UActorComponent*> GetComponentsToSave_Implementation() const override;
+
 protected:
     
     // Called when the actor is spawned or when the editor changes the actor's properties
@@ -7,6 +7,43 @@
 #include "Core/Data/Item/Crafting/CraftingStationData.h"
 #include "NomadCraftingComponent.generated.h"
 
+// Nomad Dev Team - Delegate to broadcast when jobs are queued or completed
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCraftingQueueChanged);
+
+/**
+ * A batch of crafts queued on a station.
+ * Only timestamps are stored: completed crafts are derived from the current time when the queue is resolved,
+ * so the job keeps progressing while the station is unloaded or the game is closed.
+ */
+USTRUCT(BlueprintType)
+struct FNomadCraftingJob
+{
+    GENERATED_BODY()
+
+    // Item produced by each craft
+    UPROPERTY(SaveGame, BlueprintReadOnly, Category = "Crafting")
+    TSubclassOf<AACFItem> OutputItemClass;
+
+    // Amount of OutputItemClass produced by each craft
+    UPROPERTY(SaveGame, BlueprintReadOnly, Category = "Crafting")
+    int32 OutputCount = 1;
+
+    // Crafts still to be completed
+    UPROPERTY(SaveGame, BlueprintReadOnly, Category = "Crafting")
+    int32 RemainingCrafts = 0;
+
+    // Queue time (UTC seconds) at which the current craft started
+    UPROPERTY(SaveGame, BlueprintReadOnly, Category = "Crafting")
+    double StartTime = 0.0;
+
+    // Seconds needed by a single craft
+    UPROPERTY(SaveGame, BlueprintReadOnly, Category = "Crafting")
+    float CraftDuration = 0.f;
+
+    // Queue time at which the last remaining craft completes
+    double GetEndTime() const { return StartTime + static_cast<double>(CraftDuration) * RemainingCrafts; }
+};
+
 /**
  * 
  */
@@ -20,4 +57,50 @@ public:
     // Initializes the crafting component with data from a crafting station data asset.
     UFUNCTION(BlueprintCallable, Category = "ACF | Initialization")
     void InitializeFromDataAsset(UCraftingStationData* CraftingStationData);
-};
\ No newline at end of file
+
+    // SERVER: appends a job to the crafting queue. Resources must be consumed by the caller (see UACFItemsManagerComponent::QueueCraftItem).
+    virtual bool EnqueueCraft(const FACFCraftingRecipe& Recipe, int32 Count, APawn* InstigatorPawn) override;
+
+    // SERVER: moves every craft completed since the last resolve into this station's storage.
+    UFUNCTION(BlueprintCallable, Category = "Crafting | Queue")
+    void ResolveCraftingQueue();
+
+    // Returns the queued jobs, the first one is the one being crafted.
+    UFUNCTION(BlueprintPure, Category = "Crafting | Queue")
+    const TArray<FNomadCraftingJob>& GetCraftingQueue() const { return CraftingQueue; }
+
+    // Returns the progress (0-1) of the craft currently running in the given job, 0 if the job is still waiting.
+    UFUNCTION(BlueprintPure, Category = "Crafting | Queue")
+    float GetQueuedJobProgress(int32 JobIndex) const;
+
+    UFUNCTION(BlueprintPure, Category = "Crafting | Queue")
+    bool HasQueuedCrafts() const { return CraftingQueue.Num() > 0; }
+
+    // Queue time at which the next craft of the queue completes.
+    double GetNextCompletionTime() const;
+
+    UPROPERTY(BlueprintAssignable, Category = "Crafting | Delegates")
+    FOnCraftingQueueChanged OnCraftingQueueChanged;
+
+protected:
+    virtual void BeginPlay() override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    // Catches up on the crafts completed while the station was saved.
+    virtual void OnComponentLoaded_Implementation() override;
+
+    // Maximum number of jobs that can be queued at once.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crafting | Queue", meta = (ClampMin = 1))
+    int32 MaxQueuedJobs = 5;
+
+private:
+    UPROPERTY(SaveGame, ReplicatedUsing = OnRep_CraftingQueue)
+    TArray<FNomadCraftingJob> CraftingQueue;
+
+    UFUNCTION()
+    void OnRep_CraftingQueue();
+
+    // Registers the queue in the world scheduler while it has pending crafts.
+    void RegisterCraftingQueue();
+};
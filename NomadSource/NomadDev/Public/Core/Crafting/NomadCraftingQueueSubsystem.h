@@ -0,0 +1,43 @@
+// Copyright (C) Developed by Gamegine, Published by Gamegine 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NomadCraftingQueueSubsystem.generated.h"
+
+class UNomadCraftingComponent;
+
+/**
+ * Single scheduler for the crafting queues of the loaded crafting stations.
+ * Queued jobs only store timestamps, so stations are resolved lazily when queried or reloaded;
+ * this subsystem only keeps one timer armed for the earliest completion among loaded stations.
+ * Unloaded stations are not tracked at all and catch up from their saved timestamps.
+ */
+UCLASS()
+class NOMADDEV_API UNomadCraftingQueueSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Time used by crafting queues: UTC seconds, keeps running while the station is unloaded or the game is closed.
+    static double GetQueueTime();
+
+    // Tracks the station until its queue is empty and reschedules the next completion.
+    void RegisterQueue(UNomadCraftingComponent* CraftingComponent);
+
+    // Stops tracking the station, e.g. when it is unloaded.
+    void UnregisterQueue(UNomadCraftingComponent* CraftingComponent);
+
+    virtual void Deinitialize() override;
+
+private:
+    void ScheduleNextResolve();
+
+    void HandleResolveTimer();
+
+    UPROPERTY()
+    TArray<TWeakObjectPtr<UNomadCraftingComponent>> ActiveQueues;
+
+    FTimerHandle ResolveTimerHandle;
+};
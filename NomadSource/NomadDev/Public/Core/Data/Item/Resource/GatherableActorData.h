@@ -66,6 +66,22 @@ struct FGatheredItem {
 };
 
 
+/**
+ * EGatheredLootSpawnMode
+ *
+ * How the loot of a fully gathered resource is handed out.
+ */
+UENUM(BlueprintType)
+enum class EGatheredLootSpawnMode : uint8
+{
+    // One world item per gathered unit (legacy behaviour, one replicated actor per unit).
+    EPerUnit UMETA(DisplayName = "One World Item Per Unit"),
+    // World items holding up to the item's max inventory stack each.
+    EStacked UMETA(DisplayName = "Stacked World Items"),
+    // Straight into the gatherer's inventory, whatever doesn't fit is dropped as stacked world items.
+    EDirectToInventory UMETA(DisplayName = "Direct To Gatherer Inventory"),
+};
+
 /**
  * FGatherableActorInfo
  *
@@ -180,6 +196,12 @@ struct FGatherableActorInfo
     UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "!bUseNextStage"), Category = "Loot")
     TArray<FGatheredItem> ItemsToGive;
 
+    /**
+     * How the loot is handed out when gathering completes.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "!bUseNextStage"), Category = "Loot")
+    EGatheredLootSpawnMode LootSpawnMode = EGatheredLootSpawnMode::EStacked;
+
     // === Health & Damage Handling ===
 
     /**
@@ -288,6 +310,12 @@ struct FGatherableActorInfo
         return ItemsToGive;
     }
 
+    /** @return how the loot is handed out upon gathering. */
+    FORCEINLINE EGatheredLootSpawnMode GetLootSpawnMode() const
+    {
+        return LootSpawnMode;
+    }
+
     /** @return maximum hit points of the gatherable actor. */
     FORCEINLINE int32 GetMaxHealth() const
     {
@@ -29,6 +29,9 @@ public:
     UFUNCTION()
     void StopPhysics();
 
+    // Called only on the server: folds nearby resting world items of the same item into this one
+    void TryMergeWithNearbyItems();
+
     // Timer handles:
     FTimerHandle PhysicsStartTimerHandle;
     FTimerHandle PhysicsStopTimerHandle;
@@ -58,6 +61,10 @@ public:
     UPROPERTY(EditAnywhere, Category = ACF)
     TArray<FTimedAttributeSetModifier> OnPickupBuff;
 
+    // Radius used to find resting world items of the same item to merge with, 0 disables merging
+    UPROPERTY(EditAnywhere, Category = ACF)
+    float MergeRadius = 150.f;
+
     void SetPickupItemData(UPickupItemActorData* InPickupItemActorData) { PickupItemData = InPickupItemActorData; }
 
     virtual FText GetInteractableName_Implementation() override;
@@ -12,6 +12,7 @@
 #include "BaseGatherableActor.generated.h"
 
 class UACFStorageComponent; // Forward declaration of the storage component for inventory management
+class ANomadResourceNodeManager;
 
 
 UCLASS()
@@ -46,6 +47,13 @@ public:
     // Stores control rotation vector passed from the interacting player
     virtual void GetCharacterControlRotation_Implementation(FRotator ControlRotation, FVector ForwardVector) override;
 
+    // Sets the pawn gathering this resource, receives the loot when the loot spawn mode is direct to inventory
+    UFUNCTION(BlueprintCallable, Category = "Gatherable")
+    void SetGatherer(APawn* InGatherer);
+
+    // Binds this actor to a node of a resource node manager, must be called before the actor finishes spawning
+    void InitializeFromResourceNode(ANomadResourceNodeManager* InManager, int32 InNodeIndex, UGatherableActorData* InGatherableItemData);
+
 protected:
     // Called when the actor is spawned or when the editor changes the actor's properties
     virtual void OnConstruction(const FTransform& Transform) override;
@@ -76,6 +84,15 @@ protected:
     /** Interface function to return bGatherableActorDepleted (e.g., no resources left) */
     virtual bool GetGatherableActorDepleted_Implementation() const override;
 
+    /** Pawn currently gathering this resource, see SetGatherer */
+    TWeakObjectPtr<APawn> Gatherer;
+
+    /** Manager this actor was promoted from, gathering progress is reported back to it */
+    TWeakObjectPtr<ANomadResourceNodeManager> ResourceNodeManager;
+
+    /** Index of the node this actor represents in ResourceNodeManager */
+    int32 ResourceNodeIndex = INDEX_NONE;
+
     /** Timer handle used to reset the depletion flag after a specified time delay */
     FTimerHandle ResetDepletionTimer;
 
@@ -97,9 +114,11 @@ protected:
     /**
      * Entry point for a gather action (e.g., player hits the resource with a tool or action).
      * This function is called locally and forwards the request to the server if needed.
+     * On the server, InGatherer when provided becomes the gatherer receiving the loot (see SetGatherer).
+     * Clients can't pick it, the server derives it from the connection owning this actor.
      */
     UFUNCTION(BlueprintCallable, Category = "Gatherable")
-    void StartGather();
+    void StartGather(APawn* InGatherer = nullptr);
 
     /**
      * Server-side function to handle the gathering logic, ensuring that only the server modifies health and spawns new actors.
@@ -110,6 +129,9 @@ protected:
     bool ServerStartGather_Validate() { return true; }  // Always returns true, could be expanded for validation
     void ServerStartGather_Implementation();  // Implementation of the server-side logic
 
+    /** SERVER: pawn of the player owning this actor's connection, the only one that can send ServerStartGather */
+    APawn* GetOwningConnectionPawn() const;
+
     /** Called when the current health of the resource falls to zero or below */
     UFUNCTION()
     void OnGatherComplete();
@@ -117,7 +139,10 @@ protected:
     /** Spawns loot items based on the current data and sends them to the player */
     void SpawnGatheredLoot();
 
-    /** Handles resetting or updating the mesh and/or state of the actor after gathering */
+    /** Spawns Count units of the entry as world items holding up to MaxStackSize units each */
+    void SpawnLootWorldItems(const FGatheredItem& Entry, int32 Count, int32 MaxStackSize);
+
+    /** Handles resetting or updating the mesh and/or state of the actor after gathering, releases the gatherer once depleted */
     void HandlePostGather();
 
     /** Changes the mesh of the resource based on its current health and depletion state */
@@ -0,0 +1,215 @@
+// Copyright (C) Developed by Gamegine, Published by Gamegine 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Interfaces/ACFInteractableInterface.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "NomadResourceNodeManager.generated.h"
+
+class ABaseGatherableActor;
+class ANomadResourceNodeManager;
+class UGatherableActorData;
+class UHierarchicalInstancedStaticMeshComponent;
+
+/**
+ * ENomadResourceNodeStage
+ *
+ * Lifecycle of a single resource node owned by a ANomadResourceNodeManager.
+ */
+UENUM(BlueprintType)
+enum class ENomadResourceNodeStage : uint8
+{
+    // Rendered as an instance, no actor exists for it.
+    EUntouched UMETA(DisplayName = "Untouched"),
+    // Being gathered, represented by a real gatherable actor.
+    EPromoted UMETA(DisplayName = "Promoted"),
+    // Fully gathered, hidden until it respawns.
+    EDepleted UMETA(DisplayName = "Depleted"),
+};
+
+/**
+ * Replicated state of a node that is not untouched.
+ * Untouched nodes have no entry, so clients only receive the nodes that actually changed.
+ */
+USTRUCT()
+struct FNomadResourceNodeDelta : public FFastArraySerializerItem
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 NodeIndex = INDEX_NONE;
+
+    UPROPERTY()
+    ENomadResourceNodeStage Stage = ENomadResourceNodeStage::EUntouched;
+};
+
+/**
+ * Changed nodes of a manager, replicated as a fast array so that a depletion or respawn only sends that node.
+ */
+USTRUCT()
+struct FNomadResourceNodeDeltaArray : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FNomadResourceNodeDelta> Items;
+
+    // SERVER: adds or updates the entry of the node, untouched nodes are removed
+    void SetNodeStage(int32 NodeIndex, ENomadResourceNodeStage Stage);
+
+    void SetOwner(ANomadResourceNodeManager* InOwner) { Owner = InOwner; }
+
+    // FAST ARRAY CALLBACKS //
+    void PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize);
+
+    void PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize);
+
+    void PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 FinalSize);
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FNomadResourceNodeDelta, FNomadResourceNodeDeltaArray>(Items, DeltaParms, *this);
+    }
+
+private:
+    ANomadResourceNodeManager* Owner = nullptr;
+};
+
+template <>
+struct TStructOpsTypeTraits<FNomadResourceNodeDeltaArray> : public TStructOpsTypeTraitsBase2<FNomadResourceNodeDeltaArray>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true,
+    };
+};
+
+/**
+ * ANomadResourceNodeManager
+ *
+ * Represents thousands of resource nodes of the same type (trees, rocks...) as instances of a single
+ * instanced mesh instead of one replicated actor each. Per node, only a compact state is kept on the server.
+ * A node is promoted to a real gatherable actor when a player starts gathering it, and demoted back to
+ * an instance once it is depleted or left alone. Respawns and demotions run from a single timer,
+ * and only the nodes that are not untouched are replicated.
+ * Interactions with the manager are routed to the node the pawn is looking at, which gets promoted.
+ */
+UCLASS()
+class NOMADDEV_API ANomadResourceNodeManager : public AActor, public IACFInteractableInterface
+{
+    GENERATED_BODY()
+
+public:
+    ANomadResourceNodeManager();
+
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+    /**
+     * SERVER: returns the gatherable actor of the node, promoting it if needed.
+     * Returns nullptr if the node is depleted or the index is invalid.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Resource Nodes")
+    ABaseGatherableActor* PromoteNode(int32 NodeIndex);
+
+    /** SERVER: promotes the node hit by a trace against the node instances, see PromoteNode. */
+    UFUNCTION(BlueprintCallable, Category = "Resource Nodes")
+    ABaseGatherableActor* PromoteNodeFromHit(const FHitResult& Hit);
+
+    /** @return the current stage of the node. */
+    UFUNCTION(BlueprintPure, Category = "Resource Nodes")
+    ENomadResourceNodeStage GetNodeStage(int32 NodeIndex) const;
+
+    /** @return the number of nodes owned by this manager. */
+    UFUNCTION(BlueprintPure, Category = "Resource Nodes")
+    int32 GetNodeCount() const { return OriginalTransforms.Num(); }
+
+    /** SERVER: health the promoted actor of the node starts with. */
+    int32 GetNodeHealth(int32 NodeIndex) const;
+
+    /** SERVER: called by the promoted actor on each hit, keeps the node promoted and stores its health. */
+    void NotifyNodeHit(int32 NodeIndex, int32 Health);
+
+    /** SERVER: called by the promoted actor once fully gathered, hides the node until it respawns. */
+    void NotifyNodeDepleted(int32 NodeIndex);
+
+    /** Shows or hides the instance of the node, called on the server and from replication on clients. */
+    void ApplyNodeStage(int32 NodeIndex, ENomadResourceNodeStage Stage);
+
+protected:
+    virtual void BeginPlay() override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    /** SERVER: promotes the node the pawn interacted with and forwards the interaction to its actor. */
+    virtual void OnInteractedByPawn_Implementation(class APawn* Pawn, const FString& interactionType = "") override;
+
+    /** Location of the nearest node that can still be gathered, so interaction scoring doesn't use the manager origin. */
+    virtual FVector GetInteractionLocation_Implementation(const FVector& viewLocation) const override;
+
+    /** Instances of the nodes, painted or placed by designers. The instance index is the node index. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Resource Nodes")
+    TObjectPtr<UHierarchicalInstancedStaticMeshComponent> NodeInstances;
+
+    /** Data shared by every node of this manager, also assigned to the promoted actors. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Resource Nodes")
+    TObjectPtr<UGatherableActorData> GatherableItemData;
+
+    /** Actor spawned when a node starts being gathered. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Resource Nodes")
+    TSubclassOf<ABaseGatherableActor> GatherableActorClass;
+
+    /** Seconds before a depleted node comes back. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Resource Nodes", meta = (ClampMin = 0))
+    float RespawnDelay = 300.f;
+
+    /** Reach of the trace from the pawn's view used to find the node it interacted with. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Resource Nodes", meta = (ClampMin = 0))
+    float InteractionDistance = 400.f;
+
+    /** Seconds without hits before a promoted node goes back to being an instance, keeping its health. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Resource Nodes", meta = (ClampMin = 1))
+    float PromotedIdleTime = 30.f;
+
+private:
+    /** Compact server state of a node */
+    struct FNomadResourceNode
+    {
+        int32 Health = 0;
+        ENomadResourceNodeStage Stage = ENomadResourceNodeStage::EUntouched;
+        // World time of the next respawn (depleted) or demotion (promoted)
+        float StageEndTime = 0.f;
+    };
+
+    UPROPERTY(Replicated)
+    FNomadResourceNodeDeltaArray NodeDeltas;
+
+    /** Instance transforms as authored, used to restore hidden instances */
+    TArray<FTransform> OriginalTransforms;
+
+    /** SERVER: per node state, indexed like the instances */
+    TArray<FNomadResourceNode> Nodes;
+
+    /** SERVER: nodes that are not untouched, the only ones the scheduler looks at */
+    TSet<int32> ActiveNodes;
+
+    /** SERVER: actors of the promoted nodes */
+    TMap<int32, TWeakObjectPtr<ABaseGatherableActor>> PromotedActors;
+
+    FTimerHandle SchedulerTimerHandle;
+
+    void SetNodeStage(int32 NodeIndex, ENomadResourceNodeStage Stage, float StageDuration);
+
+    /** SERVER: traces the pawn's view against the node instances and promotes the node hit, or the nearest one in reach. */
+    ABaseGatherableActor* PromoteInteractedNode(const APawn* Pawn);
+
+    /** Nearest node within Radius of Location that is not depleted, from the replicated stages on clients. INDEX_NONE if none. */
+    int32 FindNearestNode(const FVector& Location, float Radius) const;
+
+    void DemoteNode(int32 NodeIndex);
+
+    void ScheduleNextUpdate();
+
+    void HandleSchedulerTimer();
+};